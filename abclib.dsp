@@ -2143,6 +2143,10 @@ SOURCE=.\src\sat\bmc\bmcMulti.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcUnroll.c
 # End Source File
 # End Group
@@ -3471,6 +3475,10 @@ SOURCE=.\src\map\super\superAnd.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\super\superCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\super\superGate.c
 # End Source File
 # Begin Source File
@@ -3759,6 +3767,10 @@ SOURCE=.\src\map\scl\sclSize.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclSta.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclSize.h
 # End Source File
 # Begin Source File
@@ -5723,6 +5735,10 @@ SOURCE=.\src\proof\dch\dchMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\dch\dchPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\dch\dchSat.c
 # End Source File
 # Begin Source File
@@ -5927,6 +5943,14 @@ SOURCE=.\src\proof\int\intMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\int\intPar.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\proof\int\intSat2.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\int\intUtil.c
 # End Source File
 # End Group
@@ -6007,6 +6031,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
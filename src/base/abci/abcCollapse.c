@@ -28,6 +28,17 @@
 #include "bdd/extrab/extraBdd.h"
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -244,6 +255,164 @@ Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, i
     return pNtkNew;
 }
 
+#ifndef ABC_USE_PTHREADS
+
+Abc_Ntk_t * Abc_NtkCollapsePar( Abc_Ntk_t * pNtk, int fBddSizeMax, int fReorder, int fReverse, int nProcs, int fVerbose )
+{
+    return Abc_NtkCollapse( pNtk, fBddSizeMax, 0, fReorder, fReverse, 0, fVerbose );
+}
+
+#else // pthreads are used
+
+#define ABC_CLP_THR_MAX 64
+
+typedef struct Abc_ClpThData_t_ Abc_ClpThData_t;
+struct Abc_ClpThData_t_
+{
+    Abc_Ntk_t *     pNtk;          // the cones of one group of COs
+    DdManager *     dd;            // the manager with their global BDDs
+    int             nBddSizeMax;   // limit on the live BDD nodes
+    int             fReorder;      // dynamic variable reordering
+    int             fReverse;      // reverse variable ordering
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the global BDDs of one group of COs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_NtkCollapseWorkerThread( void * pArg )
+{
+    Abc_ClpThData_t * pThData = (Abc_ClpThData_t *)pArg;
+    pThData->dd = (DdManager *)Abc_NtkBuildGlobalBddsInt( pThData->pNtk, pThData->nBddSizeMax, 1, pThData->fReorder, pThData->fReverse, 0, 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collapses the network using several BDD managers.]
+
+  Description [The COs are divided into nProcs groups of consecutive COs.
+  The cones of each group are copied into a separate AIG, whose global
+  BDDs are built by a separate thread in its own manager, with its own
+  variable reordering. The node functions are then transferred into the
+  manager of the new network, as in the sequential case. Since the
+  managers do not share nodes, the total BDD size may be larger than
+  with one manager, but each of them is smaller and reorders faster.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Abc_NtkCollapsePar( Abc_Ntk_t * pNtk, int fBddSizeMax, int fReorder, int fReverse, int nProcs, int fVerbose )
+{
+    Abc_ClpThData_t ThData[ABC_CLP_THR_MAX];
+    pthread_t WorkerThread[ABC_CLP_THR_MAX];
+    Abc_Ntk_t * pNtkNew = NULL;
+    Abc_Obj_t * pObj, * pDriver, * pNodeNew;
+    Vec_Ptr_t * vCos, * vRoots;
+    abctime clk = Abc_Clock();
+    int i, k, iCo, nCos, status, fFail = 0;
+
+    assert( Abc_NtkIsStrash(pNtk) );
+    // collect the COs whose functions are derived using BDDs
+    vCos = Vec_PtrAlloc( Abc_NtkCoNum(pNtk) );
+    Abc_NtkForEachCo( pNtk, pObj, i )
+    {
+        pDriver = Abc_ObjFanin0(pObj);
+        if ( Abc_ObjIsCi(pDriver) && !strcmp(Abc_ObjName(pObj), Abc_ObjName(pDriver)) )
+            continue;
+        Vec_PtrPush( vCos, pObj );
+    }
+    nCos = Vec_PtrSize(vCos);
+    nProcs = Abc_MinInt( nProcs, Abc_MinInt(nCos, ABC_CLP_THR_MAX) );
+    if ( nProcs < 2 || pNtk->pExdc )
+    {
+        Vec_PtrFree( vCos );
+        return Abc_NtkCollapse( pNtk, fBddSizeMax, 0, fReorder, fReverse, 0, fVerbose );
+    }
+
+    // copy the cones of each group and build their BDDs concurrently
+    for ( k = 0; k < nProcs; k++ )
+    {
+        vRoots = Vec_PtrAlloc( nCos / nProcs + 1 );
+        for ( i = k * nCos / nProcs; i < (k + 1) * nCos / nProcs; i++ )
+            Vec_PtrPush( vRoots, Vec_PtrEntry(vCos, i) );
+        ThData[k].pNtk        = Abc_NtkCreateConeArray( pNtk, vRoots, 1 );
+        ThData[k].dd          = NULL;
+        ThData[k].nBddSizeMax = fBddSizeMax;
+        ThData[k].fReorder    = fReorder;
+        ThData[k].fReverse    = fReverse;
+        Vec_PtrFree( vRoots );
+        status = pthread_create( WorkerThread + k, NULL, Abc_NtkCollapseWorkerThread, (void *)(ThData + k) );  assert( status == 0 );
+    }
+    for ( k = 0; k < nProcs; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+        fFail |= (ThData[k].dd == NULL);
+    }
+    if ( fVerbose )
+    {
+        for ( k = 0; k < nProcs; k++ )
+            if ( ThData[k].dd )
+                printf( "Manager %2d : COs = %6d.  BDD size = %9d nodes.\n", k, Abc_NtkCoNum(ThData[k].pNtk), 
+                    Cudd_ReadKeys(ThData[k].dd) - Cudd_ReadDead(ThData[k].dd) );
+        ABC_PRT( "BDD construction time", Abc_Clock() - clk );
+    }
+
+    // create the new network
+    if ( !fFail )
+    {
+        pNtkNew = Abc_NtkStartFrom( pNtk, ABC_NTK_LOGIC, ABC_FUNC_BDD );
+        Cudd_bddIthVar( (DdManager *)pNtkNew->pManFunc, Abc_NtkCiNum(pNtk)-1 );
+        k = iCo = 0;
+        Abc_NtkForEachCo( pNtk, pObj, i )
+        {
+            pDriver = Abc_ObjFanin0(pObj);
+            if ( Abc_ObjIsCi(pDriver) && !strcmp(Abc_ObjName(pObj), Abc_ObjName(pDriver)) )
+            {
+                Abc_ObjAddFanin( pObj->pCopy, pDriver->pCopy );
+                continue;
+            }
+            while ( iCo >= (k + 1) * nCos / nProcs )
+                k++;
+            pDriver = Abc_NtkCo( ThData[k].pNtk, iCo++ - k * nCos / nProcs );
+            pNodeNew = Abc_NodeFromGlobalBdds( pNtkNew, ThData[k].dd, (DdNode *)Abc_ObjGlobalBdd(pDriver), fReverse );
+            Abc_ObjAddFanin( pObj->pCopy, pNodeNew );
+        }
+        assert( iCo == nCos );
+    }
+    for ( k = 0; k < nProcs; k++ )
+    {
+        if ( ThData[k].dd )
+            Abc_NtkFreeGlobalBdds( ThData[k].pNtk, 1 );
+        Abc_NtkDelete( ThData[k].pNtk );
+    }
+    Vec_PtrFree( vCos );
+    if ( pNtkNew == NULL )
+        return NULL;
+
+    // make the network minimum base
+    Abc_NtkMinimumBase2( pNtkNew );
+
+    // make sure that everything is okay
+    if ( !Abc_NtkCheck( pNtkNew ) )
+    {
+        printf( "Abc_NtkCollapsePar: The network check has failed.\n" );
+        Abc_NtkDelete( pNtkNew );
+        return NULL;
+    }
+    return pNtkNew;
+}
+
+#endif // pthreads are used
 
 #else
 
@@ -251,6 +420,10 @@ Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, i
 {
     return NULL;
 }
+Abc_Ntk_t * Abc_NtkCollapsePar( Abc_Ntk_t * pNtk, int fBddSizeMax, int fReorder, int fReverse, int nProcs, int fVerbose )
+{
+    return NULL;
+}
 
 #endif
 
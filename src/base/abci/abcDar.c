@@ -36,6 +36,7 @@
 #include "proof/pdr/pdr.h"
 #include "sat/bmc/bmc.h"
 #include "map/mio/mio.h"
+#include "sat/glucose2/AbcGlucose2.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1838,7 +1839,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int nProcs, int fChangePol, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1864,7 +1865,7 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
 
     // derive CNF
     if ( fFastAlgo )
-        pCnf = Cnf_DeriveFast( pMan, 0 );
+        pCnf = Cnf_DeriveFastPar( pMan, 0, nProcs );
     else
         pCnf = Cnf_Derive( pMan, 0 );
 
@@ -1920,6 +1921,108 @@ int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves combinational miter using a portfolio of SAT solvers.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDSatPort( Abc_Ntk_t * pNtk, int nConfLimit, int fAlignPol, int fAndOuts, int nProcs, int fVerbose )
+{
+    Bmc_Port_t * pPort;
+    Aig_Man_t * pMan;
+    Cnf_Dat_t * pCnf;
+    Aig_Obj_t * pObj;
+    Vec_Int_t * vCiIds, * vLits;
+    int i, status, RetValue = -1;
+    assert( Abc_NtkIsStrash(pNtk) );
+    assert( Abc_NtkLatchNum(pNtk) == 0 );
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+    if ( fAlignPol ) 
+        Cnf_DataTranformPolarity( pCnf, 0 );
+    // load the clauses
+    pPort = Bmc_PortStart( nProcs, 1, fVerbose );
+    Bmc_PortSetNVars( pPort, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        Bmc_PortAddClause( pPort, pCnf->pClauses[i], pCnf->pClauses[i+1] - pCnf->pClauses[i] );
+    // assert the outputs
+    vLits = Vec_IntAlloc( Aig_ManCoNum(pMan) );
+    Aig_ManForEachCo( pMan, pObj, i )
+        Vec_IntPush( vLits, Abc_Var2Lit(pCnf->pVarNums[pObj->Id], 0) );
+    if ( fAndOuts )
+        Vec_IntForEachEntry( vLits, status, i )
+            Bmc_PortAddClause( pPort, &status, 1 );
+    else
+        Bmc_PortAddClause( pPort, Vec_IntArray(vLits), Vec_IntSize(vLits) );
+    Vec_IntFree( vLits );
+    vCiIds = Cnf_DataCollectPiSatNums( pCnf, pMan );
+    Cnf_DataFree( pCnf );
+    // solve the miter
+    Bmc_PortSetConflictLimit( pPort, nConfLimit );
+    status = Bmc_PortSolve( pPort, NULL, 0 );
+    if ( status == l_True )
+    {
+        pNtk->pModel = ABC_ALLOC( int, Vec_IntSize(vCiIds) );
+        for ( i = 0; i < Vec_IntSize(vCiIds); i++ )
+            pNtk->pModel[i] = Bmc_PortVarValue( pPort, Vec_IntEntry(vCiIds, i) );
+        RetValue = 0;
+    }
+    else if ( status == l_False )
+        RetValue = 1;
+    if ( fVerbose )
+        printf( "The answer was produced by engine %d.\n", Bmc_PortWinner(pPort) );
+    Bmc_PortStop( pPort );
+    Vec_IntFree( vCiIds );
+    Aig_ManStop( pMan );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves combinational miter and writes the proof of UNSAT.]
+
+  Description [The miter is solved by glucose2, which writes the DRAT
+  proof into the given file and the CNF it was checked against into 
+  the file with the extension ".cnf" appended.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDSatProof( Abc_Ntk_t * pNtk, int nConfLimit, char * pFileName, int fBinary, int fVerbose )
+{
+    Glucose2_Pars Pars = Glucose_CreatePars( 0, fVerbose, 0, nConfLimit );
+    Aig_Man_t * pMan;
+    Gia_Man_t * pGia;
+    int i, status, RetValue = -1;
+    assert( Abc_NtkIsStrash(pNtk) );
+    assert( Abc_NtkLatchNum(pNtk) == 0 );
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    pGia = Gia_ManFromAig( pMan );
+    Aig_ManStop( pMan );
+    Pars.pProof    = pFileName;
+    Pars.fBinProof = fBinary;
+    status = Glucose2_SolveAig( pGia, &Pars );
+    if ( status == 10 )
+    {
+        pNtk->pModel = ABC_CALLOC( int, Gia_ManCiNum(pGia) );
+        for ( i = 0; i < Gia_ManCiNum(pGia); i++ )
+            pNtk->pModel[i] = Abc_InfoHasBit( pGia->pCexComb->pData, i );
+        RetValue = 0;
+    }
+    else if ( status == 20 )
+        RetValue = 1;
+    Gia_ManStop( pGia );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Solves combinational miter using a SAT solver.]
@@ -2358,7 +2461,7 @@ static void sigfunc( int signo )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkDarBmc( Abc_Ntk_t * pNtk, int nStart, int nFrames, int nSizeMax, int nNodeDelta, int nTimeOut, int nBTLimit, int nBTLimitAll, int fRewrite, int fNewAlgo, int fOrDecomp, int nCofFanLit, int fVerbose, int * piFrames, int fUseSatoko )
+int Abc_NtkDarBmc( Abc_Ntk_t * pNtk, int nStart, int nFrames, int nSizeMax, int nNodeDelta, int nTimeOut, int nBTLimit, int nBTLimitAll, int fRewrite, int fNewAlgo, int fOrDecomp, int nCofFanLit, int fVerbose, int * piFrames, int fUseSatoko, int nProcs )
 {
     Aig_Man_t * pMan;
     Vec_Int_t * vMap = NULL;
@@ -2384,7 +2487,7 @@ int Abc_NtkDarBmc( Abc_Ntk_t * pNtk, int nStart, int nFrames, int nSizeMax, int
     if ( fNewAlgo ) // command 'bmc'
     {
         int iFrame;
-        RetValue = Saig_ManBmcSimple( pMan, nFrames, nSizeMax, nBTLimit, fRewrite, fVerbose, &iFrame, nCofFanLit, fUseSatoko );
+        RetValue = Saig_ManBmcSimple( pMan, nFrames, nSizeMax, nBTLimit, fRewrite, fVerbose, &iFrame, nCofFanLit, fUseSatoko, nProcs );
         if ( piFrames )
             *piFrames = iFrame;
         ABC_FREE( pNtk->pModel );
@@ -3059,6 +3162,37 @@ int Abc_NtkDarSec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, Fra_Sec_t * pSecPar )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the clauses seeding PDR from an earlier invariant.]
+
+  Description [The invariant, written by "pdr -d" for an earlier revision
+  of the design, is mapped to the current flops by name. The clauses that
+  remain inductive in the current design are returned.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Abc_NtkDarPdrSeed( Abc_Ntk_t * pNtk, Aig_Man_t * pMan, char * pFileName, int fVerbose )
+{
+    extern Vec_Int_t * Pdr_InvRead( char * pFileName, char ** pNamesFlop, int nRegs, int fVerbose );
+    extern Vec_Int_t * Pdr_InvInductiveSubset( Gia_Man_t * p, Vec_Int_t * vInv, int nBTLimit, int fVerbose );
+    Vec_Int_t * vInv, * vRes;
+    Gia_Man_t * pGia;
+    char ** pNamesCi = Abc_NtkCollectCioNames( pNtk, 0 );
+    vInv = Pdr_InvRead( pFileName, pNamesCi + Abc_NtkPiNum(pNtk), Abc_NtkLatchNum(pNtk), fVerbose );
+    ABC_FREE( pNamesCi );
+    if ( vInv == NULL )
+        return NULL;
+    pGia = Gia_ManFromAigSimple( pMan );
+    vRes = Pdr_InvInductiveSubset( pGia, vInv, 0, fVerbose );
+    Gia_ManStop( pGia );
+    Vec_IntFree( vInv );
+    return vRes;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Gives the current ABC network to AIG manager for processing.]
@@ -3081,7 +3215,10 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
         Abc_Print( 1, "Converting network into AIG has failed.\n" );
         return -1;
     }
+    if ( pPars->pSeedFileName )
+        pPars->vInvSeed = Abc_NtkDarPdrSeed( pNtk, pMan, pPars->pSeedFileName, pPars->fVerbose );
     RetValue = Pdr_ManSolve( pMan, pPars );
+    Vec_IntFreeP( &pPars->vInvSeed );
     pPars->nDropOuts = Saig_ManPoNum(pMan) - pPars->nProveOuts - pPars->nFailOuts;
     if ( !pPars->fSilent )
     {
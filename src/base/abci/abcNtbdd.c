@@ -325,7 +325,8 @@ int Abc_NtkBddToMuxesPerformGlo( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkNew, int Limi
 
   Synopsis    [Derives global BDDs for the COs of the network.]
 
-  Description []
+  Description [The progress bar is not shown if fProgress is 0, for 
+  example, when the BDDs of several networks are built concurrently.]
                
   SideEffects []
 
@@ -333,6 +334,10 @@ int Abc_NtkBddToMuxesPerformGlo( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkNew, int Limi
 
 ***********************************************************************/
 void * Abc_NtkBuildGlobalBdds( Abc_Ntk_t * pNtk, int nBddSizeMax, int fDropInternal, int fReorder, int fReverse, int fVerbose )
+{
+    return Abc_NtkBuildGlobalBddsInt( pNtk, nBddSizeMax, fDropInternal, fReorder, fReverse, 1, fVerbose );
+}
+void * Abc_NtkBuildGlobalBddsInt( Abc_Ntk_t * pNtk, int nBddSizeMax, int fDropInternal, int fReorder, int fReverse, int fProgress, int fVerbose )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pObj, * pFanin;
@@ -372,7 +377,7 @@ void * Abc_NtkBuildGlobalBdds( Abc_Ntk_t * pNtk, int nBddSizeMax, int fDropInter
     // collect the global functions of the COs
     Counter = 0;
     // construct the BDDs
-    pProgress = Extra_ProgressBarStart( stdout, Abc_NtkNodeNum(pNtk) );
+    pProgress = fProgress ? Extra_ProgressBarStart( stdout, Abc_NtkNodeNum(pNtk) ) : NULL;
     Abc_NtkForEachCo( pNtk, pObj, i )
     {
         bFunc = Abc_NodeGlobalBdds_rec( dd, Abc_ObjFanin0(pObj), nBddSizeMax, fDropInternal, pProgress, &Counter, fVerbose );
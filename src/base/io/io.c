@@ -2250,21 +2250,34 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     int c;
     int fNewAlgo;
     int fFastAlgo;
+    int nProcs;
     int fAllPrimes;
     int fChangePol;
     int fVerbose;
-    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose );
+    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int nProcs, int fChangePol, int fVerbose );
 
     fNewAlgo = 1;
     fFastAlgo = 0;
+    nProcs = 1;
     fAllPrimes = 0;
     fChangePol = 1;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nfpcvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnfpcvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
             case 'n':
                 fNewAlgo ^= 1;
                 break;
@@ -2303,9 +2316,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     }
     // call the corresponding file writer
     if ( fFastAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, nProcs, fChangePol, fVerbose );
     else if ( fNewAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, nProcs, fChangePol, fVerbose );
     else if ( fAllPrimes )
         Io_WriteCnf( pAbc->pNtkCur, pFileName, 1 );
     else
@@ -2313,8 +2326,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_cnf [-nfpcvh] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_cnf [-P num] [-nfpcvh] <file>\n" );
     fprintf( pAbc->Err, "\t         generates CNF for the miter (see also \"&write_cnf\")\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads used by the fast algorithm [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-n     : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-f     : toggle using fast algorithm [default = %s]\n", fFastAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-p     : toggle using all primes to enhance implicativity [default = %s]\n", fAllPrimes? "yes" : "no" );
@@ -94,7 +94,7 @@ int main( int argc, char * argv[] )
     {
         // perform BMC
         if ( pAig->nRegs != 0 )
-            RetValue = Saig_ManBmcSimple( pAig, nFrames, nSizeMax, nBTLimit, fRewrite, fVerbose, NULL, 0, 0 );
+            RetValue = Saig_ManBmcSimple( pAig, nFrames, nSizeMax, nBTLimit, fRewrite, fVerbose, NULL, 0, 0, 1 );
 
         // perform full-blown SEC
         if ( RetValue != 0 )
@@ -123,7 +123,7 @@ int main( int argc, char * argv[] )
         int nSizeMax = 500000;
         int nBTLimit = 10000000;
         int fRewrite = 0;
-        RetValue = Saig_ManBmcSimple( pAig, nFrames, nSizeMax, nBTLimit, fRewrite, fVerbose, &Depth, 0, 0 );
+        RetValue = Saig_ManBmcSimple( pAig, nFrames, nSizeMax, nBTLimit, fRewrite, fVerbose, &Depth, 0, 0, 1 );
         if ( RetValue != 0 )
             RetValue = -1;
     }
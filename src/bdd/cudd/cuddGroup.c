@@ -113,8 +113,6 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddGroup.c,v 1.44 2009/02/21 18:24:10 fabio Exp $";
 #endif
 
-static  int     *entry;
-extern  int     ddTotalNumberSwapping;
 #ifdef DD_STATS
 extern  int     ddTotalNISwaps;
 static  int     extsymmcalls;
@@ -127,7 +125,6 @@ static  int     secdiffmisfire;
 static  int     pr = 0; /* flag to enable printing while debugging */
                         /* by depositing a 1 into it */
 #endif
-static unsigned int originalSize;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
@@ -145,7 +142,7 @@ static int ddCountInternalMtrNodes (DdManager *table, MtrNode *treenode);
 #endif
 static int ddReorderChildren (DdManager *table, MtrNode *treenode, Cudd_ReorderingType method);
 static void ddFindNodeHiLo (DdManager *table, MtrNode *treenode, int *lower, int *upper);
-static int ddUniqueCompareGroup (int *ptrX, int *ptrY);
+static int ddUniqueCompareGroup (IndexKey *ptrX, IndexKey *ptrY);
 static int ddGroupSifting (DdManager *table, int lower, int upper, DD_CHKFP checkFunction, int lazyFlag);
 static void ddCreateGroup (DdManager *table, int x, int y);
 static int ddGroupSiftingAux (DdManager *table, int x, int xLow, int xHigh, DD_CHKFP checkFunction, int lazyFlag);
@@ -676,15 +673,15 @@ ddFindNodeHiLo(
 ******************************************************************************/
 static int
 ddUniqueCompareGroup(
-  int * ptrX,
-  int * ptrY)
+  IndexKey * ptrX,
+  IndexKey * ptrY)
 {
 #if 0
-    if (entry[*ptrY] == entry[*ptrX]) {
-        return((*ptrX) - (*ptrY));
+    if (ptrY->keys == ptrX->keys) {
+        return(ptrX->index - ptrY->index);
     }
 #endif
-    return(entry[*ptrY] - entry[*ptrX]);
+    return(ptrY->keys - ptrX->keys);
 
 } /* end of ddUniqueCompareGroup */
 
@@ -710,7 +707,7 @@ ddGroupSifting(
   DD_CHKFP checkFunction,
   int lazyFlag)
 {
-    int         *var;
+    IndexKey    *var;
     int         i,j,x,xInit;
     int         nvars;
     int         classes;
@@ -726,18 +723,12 @@ ddGroupSifting(
     nvars = table->size;
 
     /* Order variables to sift. */
-    entry = NULL;
     sifted = NULL;
-    var = ABC_ALLOC(int,nvars);
+    var = ABC_ALLOC(IndexKey,nvars);
     if (var == NULL) {
         table->errorCode = CUDD_MEMORY_OUT;
         goto ddGroupSiftingOutOfMem;
     }
-    entry = ABC_ALLOC(int,nvars);
-    if (entry == NULL) {
-        table->errorCode = CUDD_MEMORY_OUT;
-        goto ddGroupSiftingOutOfMem;
-    }
     sifted = ABC_ALLOC(int,nvars);
     if (sifted == NULL) {
         table->errorCode = CUDD_MEMORY_OUT;
@@ -749,13 +740,13 @@ ddGroupSifting(
         sifted[i] = 0;
         x = table->perm[i];
         if ((unsigned) x >= table->subtables[x].next) {
-            entry[i] = table->subtables[x].keys;
-            var[classes] = i;
+            var[classes].index = i;
+            var[classes].keys = table->subtables[x].keys;
             classes++;
         }
     }
 
-    qsort((void *)var,(size_t)classes,sizeof(int),
+    qsort((void *)var,(size_t)classes,sizeof(IndexKey),
           (DD_QSFP) ddUniqueCompareGroup);
 
     if (lazyFlag) {
@@ -766,9 +757,9 @@ ddGroupSifting(
 
     /* Now sift. */
     for (i = 0; i < ddMin(table->siftMaxVar,classes); i++) {
-        if (ddTotalNumberSwapping >= table->siftMaxSwap)
+        if (table->ddTotalNumberSwapping >= table->siftMaxSwap)
             break;
-        xindex = var[i];
+        xindex = var[i].index;
         if (sifted[xindex] == 1) /* variable already sifted as part of group */
             continue;
         x = table->perm[xindex]; /* find current level of this variable */
@@ -871,12 +862,10 @@ ddGroupSifting(
 
     ABC_FREE(sifted);
     ABC_FREE(var);
-    ABC_FREE(entry);
 
     return(1);
 
 ddGroupSiftingOutOfMem:
-    if (entry != NULL)  ABC_FREE(entry);
     if (var != NULL)    ABC_FREE(var);
     if (sifted != NULL) ABC_FREE(sifted);
 
@@ -963,7 +952,7 @@ ddGroupSiftingAux(
     initialSize = table->keys - table->isolated;
     moves = NULL;
 
-    originalSize = initialSize;         /* for lazy sifting */
+    table->originalSize = initialSize;  /* for lazy sifting */
 
     /* If we have a singleton, we check for aggregation in both
     ** directions before we sift.
@@ -2086,7 +2075,7 @@ ddVarGroupCheck(
             ddIsVarHandled(table, yindex)) {
             if (Cudd_bddIsVarToBeGrouped(table, xindex) ||
                 Cudd_bddIsVarToBeGrouped(table, yindex) ) {
-                if (table->keys - table->isolated <= originalSize) {
+                if (table->keys - table->isolated <= table->originalSize) {
                     return(1);
                 }
             }
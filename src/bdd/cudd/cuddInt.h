@@ -410,6 +410,7 @@ struct DdManager {      /* specialized DD symbol table */
     int reorderings;            /* number of calls to Cudd_ReduceHeap */
     int siftMaxVar;             /* maximum number of vars sifted */
     int siftMaxSwap;            /* maximum number of swaps per sifting */
+    int ddTotalNumberSwapping;  /* swaps in the current reordering */
     double maxGrowth;           /* maximum growth during reordering */
     double maxGrowthAlt;        /* alternate maximum growth for reordering */
     int reordCycle;             /* how often to apply alternate threshold */
@@ -427,6 +428,7 @@ struct DdManager {      /* specialized DD symbol table */
     int recomb;                 /* Used during group sifting */
     int symmviolation;          /* Used during group sifting */
     int arcviolation;           /* Used during group sifting */
+    unsigned int originalSize;  /* Used during lazy sifting */
     int populationSize;         /* population size for GA */
     int numberXovers;           /* number of crossovers for GA */
     DdLocalCache *localCaches;  /* local caches currently in existence */
@@ -497,6 +499,15 @@ typedef struct Move {
     struct Move *next;
 } Move;
 
+/* Variable and subtable size used to order the variables for sifting.
+** Sorting these pairs instead of variables indexed into a static array
+** keeps reordering reentrant, so that different managers can be
+** reordered concurrently. */
+typedef struct IndexKey {
+    int index;
+    int keys;
+} IndexKey;
+
 /* Generic level queue item. */
 typedef struct DdQueueItem {
     struct DdQueueItem *next;
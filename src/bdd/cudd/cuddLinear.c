@@ -99,10 +99,7 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddLinear.c,v 1.28 2009/02/19 16:21:03 fabio Exp $";
 #endif
 
-static  int     *entry;
-
 #ifdef DD_STATS
-extern  int     ddTotalNumberSwapping;
 extern  int     ddTotalNISwaps;
 static  int     ddTotalNumberLinearTr;
 #endif
@@ -121,7 +118,7 @@ static  int     zero = 0;
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
-static int ddLinearUniqueCompare (int *ptrX, int *ptrY);
+static int ddLinearUniqueCompare (IndexKey *ptrX, IndexKey *ptrY);
 static int ddLinearAndSiftingAux (DdManager *table, int x, int xLow, int xHigh);
 static Move * ddLinearAndSiftingUp (DdManager *table, int y, int xLow, Move *prevMoves);
 static Move * ddLinearAndSiftingDown (DdManager *table, int x, int xHigh, Move *prevMoves);
@@ -243,7 +240,7 @@ cuddLinearAndSifting(
   int  upper)
 {
     int         i;
-    int         *var;
+    IndexKey    *var;
     int         size;
     int         x;
     int         result;
@@ -258,7 +255,6 @@ cuddLinearAndSifting(
     size = table->size;
 
     var = NULL;
-    entry = NULL;
     if (table->linear == NULL) {
         result = cuddInitLinear(table);
         if (result == 0) goto cuddLinearAndSiftingOutOfMem;
@@ -278,12 +274,7 @@ cuddLinearAndSifting(
     }
 
     /* Find order in which to sift variables. */
-    entry = ABC_ALLOC(int,size);
-    if (entry == NULL) {
-        table->errorCode = CUDD_MEMORY_OUT;
-        goto cuddLinearAndSiftingOutOfMem;
-    }
-    var = ABC_ALLOC(int,size);
+    var = ABC_ALLOC(IndexKey,size);
     if (var == NULL) {
         table->errorCode = CUDD_MEMORY_OUT;
         goto cuddLinearAndSiftingOutOfMem;
@@ -291,15 +282,15 @@ cuddLinearAndSifting(
 
     for (i = 0; i < size; i++) {
         x = table->perm[i];
-        entry[i] = table->subtables[x].keys;
-        var[i] = i;
+        var[i].index = i;
+        var[i].keys = table->subtables[x].keys;
     }
 
-    qsort((void *)var,(size_t)size,sizeof(int),(DD_QSFP)ddLinearUniqueCompare);
+    qsort((void *)var,(size_t)size,sizeof(IndexKey),(DD_QSFP)ddLinearUniqueCompare);
 
     /* Now sift. */
     for (i = 0; i < ddMin(table->siftMaxVar,size); i++) {
-        x = table->perm[var[i]];
+        x = table->perm[var[i].index];
         if (x < lower || x > upper) continue;
 #ifdef DD_STATS
         previousSize = table->keys - table->isolated;
@@ -311,7 +302,7 @@ cuddLinearAndSifting(
             (void) fprintf(table->out,"-");
         } else if (table->keys > (unsigned) previousSize + table->isolated) {
             (void) fprintf(table->out,"+");     /* should never happen */
-            (void) fprintf(table->out,"\nSize increased from %d to %d while sifting variable %d\n", previousSize, table->keys - table->isolated, var[i]);
+            (void) fprintf(table->out,"\nSize increased from %d to %d while sifting variable %d\n", previousSize, table->keys - table->isolated, var[i].index);
         } else {
             (void) fprintf(table->out,"=");
         }
@@ -323,7 +314,6 @@ cuddLinearAndSifting(
     }
 
     ABC_FREE(var);
-    ABC_FREE(entry);
 
 #ifdef DD_STATS
     (void) fprintf(table->out,"\n#:L_LINSIFT %8d: linear trans.",
@@ -334,7 +324,6 @@ cuddLinearAndSifting(
 
 cuddLinearAndSiftingOutOfMem:
 
-    if (entry != NULL) ABC_FREE(entry);
     if (var != NULL) ABC_FREE(var);
 
     return(0);
@@ -870,15 +859,15 @@ cuddResizeLinear(
 ******************************************************************************/
 static int
 ddLinearUniqueCompare(
-  int * ptrX,
-  int * ptrY)
+  IndexKey * ptrX,
+  IndexKey * ptrY)
 {
 #if 0
-    if (entry[*ptrY] == entry[*ptrX]) {
-        return((*ptrX) - (*ptrY));
+    if (ptrY->keys == ptrX->keys) {
+        return(ptrX->index - ptrY->index);
     }
 #endif
-    return(entry[*ptrY] - entry[*ptrX]);
+    return(ptrY->keys - ptrX->keys);
 
 } /* end of ddLinearUniqueCompare */
 
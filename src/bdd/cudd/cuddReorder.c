@@ -102,9 +102,6 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddReorder.c,v 1.69 2009/02/21 18:24:10 fabio Exp $";
 #endif
 
-static  int     *entry;
-
-int     ddTotalNumberSwapping;
 #ifdef DD_STATS
 int     ddTotalNISwaps;
 #endif
@@ -119,7 +116,7 @@ int     ddTotalNISwaps;
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
-static int ddUniqueCompare (int *ptrX, int *ptrY);
+static int ddUniqueCompare (IndexKey *ptrX, IndexKey *ptrY);
 static Move * ddSwapAny (DdManager *table, int x, int y);
 static int ddSiftingAux (DdManager *table, int x, int xLow, int xHigh);
 static Move * ddSiftingUp (DdManager *table, int y, int xLow);
@@ -214,7 +211,7 @@ Cudd_ReduceHeap(
     }
 
     if (!ddReorderPreprocess(table)) return(0);
-    ddTotalNumberSwapping = 0;
+    table->ddTotalNumberSwapping = 0;
 
     if (table->keys > table->peakLiveNodes) {
         table->peakLiveNodes = table->keys;
@@ -280,7 +277,7 @@ Cudd_ReduceHeap(
     (void) fprintf(table->out,"#:T_REORDER %8g: total time (sec)\n",
                    ((double)(util_cpu_time() - localTime)/1000.0));
     (void) fprintf(table->out,"#:N_REORDER %8d: total swaps\n",
-                   ddTotalNumberSwapping);
+                   table->ddTotalNumberSwapping);
     (void) fprintf(table->out,"#:M_REORDER %8d: NI swaps\n",ddTotalNISwaps);
 #endif
 
@@ -512,7 +509,7 @@ cuddSifting(
   int  upper)
 {
     int i;
-    int *var;
+    IndexKey *var;
     int size;
     int x;
     int result;
@@ -523,13 +520,7 @@ cuddSifting(
     size = table->size;
 
     /* Find order in which to sift variables. */
-    var = NULL;
-    entry = ABC_ALLOC(int,size);
-    if (entry == NULL) {
-        table->errorCode = CUDD_MEMORY_OUT;
-        goto cuddSiftingOutOfMem;
-    }
-    var = ABC_ALLOC(int,size);
+    var = ABC_ALLOC(IndexKey,size);
     if (var == NULL) {
         table->errorCode = CUDD_MEMORY_OUT;
         goto cuddSiftingOutOfMem;
@@ -537,17 +528,17 @@ cuddSifting(
 
     for (i = 0; i < size; i++) {
         x = table->perm[i];
-        entry[i] = table->subtables[x].keys;
-        var[i] = i;
+        var[i].index = i;
+        var[i].keys = table->subtables[x].keys;
     }
 
-    qsort((void *)var,(size_t)size,sizeof(int),(DD_QSFP)ddUniqueCompare);
+    qsort((void *)var,(size_t)size,sizeof(IndexKey),(DD_QSFP)ddUniqueCompare);
 
     /* Now sift. */
     for (i = 0; i < ddMin(table->siftMaxVar,size); i++) {
-        if (ddTotalNumberSwapping >= table->siftMaxSwap)
+        if (table->ddTotalNumberSwapping >= table->siftMaxSwap)
             break;
-        x = table->perm[var[i]];
+        x = table->perm[var[i].index];
 
         if (x < lower || x > upper || table->subtables[x].bindVar == 1)
             continue;
@@ -561,7 +552,7 @@ cuddSifting(
             (void) fprintf(table->out,"-");
         } else if (table->keys > (unsigned) previousSize + table->isolated) {
             (void) fprintf(table->out,"+");     /* should never happen */
-            (void) fprintf(table->err,"\nSize increased from %d to %d while sifting variable %d\n", previousSize, table->keys - table->isolated, var[i]);
+            (void) fprintf(table->err,"\nSize increased from %d to %d while sifting variable %d\n", previousSize, table->keys - table->isolated, var[i].index);
         } else {
             (void) fprintf(table->out,"=");
         }
@@ -570,13 +561,11 @@ cuddSifting(
     }
 
     ABC_FREE(var);
-    ABC_FREE(entry);
 
     return(1);
 
 cuddSiftingOutOfMem:
 
-    if (entry != NULL) ABC_FREE(entry);
     if (var != NULL) ABC_FREE(var);
 
     return(0);
@@ -629,7 +618,7 @@ cuddSwapping(
     iterate = nvars;
 
     for (i = 0; i < iterate; i++) {
-        if (ddTotalNumberSwapping >= table->siftMaxSwap)
+        if (table->ddTotalNumberSwapping >= table->siftMaxSwap)
             break;
         if (heuristic == CUDD_REORDER_RANDOM_PIVOT) {
             max = -1;
@@ -797,7 +786,7 @@ cuddSwapInPlace(
     assert(table->subtables[y].dead == 0);
 #endif
 
-    ddTotalNumberSwapping++;
+    table->ddTotalNumberSwapping++;
 
     /* Get parameters of x subtable. */
     xindex = table->invperm[x];
@@ -1322,15 +1311,15 @@ cuddBddAlignToZdd(
 ******************************************************************************/
 static int
 ddUniqueCompare(
-  int * ptrX,
-  int * ptrY)
+  IndexKey * ptrX,
+  IndexKey * ptrY)
 {
 #if 0
-    if (entry[*ptrY] == entry[*ptrX]) {
-        return((*ptrX) - (*ptrY));
+    if (ptrY->keys == ptrX->keys) {
+        return(ptrX->index - ptrY->index);
     }
 #endif
-    return(entry[*ptrY] - entry[*ptrX]);
+    return(ptrY->keys - ptrX->keys);
 
 } /* end of ddUniqueCompare */
 
@@ -1911,7 +1900,7 @@ ddShuffle(
     int         previousSize;
 #endif
 
-    ddTotalNumberSwapping = 0;
+    table->ddTotalNumberSwapping = 0;
 #ifdef DD_STATS
     localTime = util_cpu_time();
     initialSize = table->keys - table->isolated;
@@ -1949,7 +1938,7 @@ ddShuffle(
     (void) fprintf(table->out,"#:T_SHUFFLE %8g: total time (sec)\n",
         ((double)(util_cpu_time() - localTime)/1000.0));
     (void) fprintf(table->out,"#:N_SHUFFLE %8d: total swaps\n",
-                   ddTotalNumberSwapping);
+                   table->ddTotalNumberSwapping);
     (void) fprintf(table->out,"#:M_SHUFFLE %8d: NI swaps\n",ddTotalNISwaps);
 #endif
 
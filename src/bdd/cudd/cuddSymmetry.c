@@ -94,9 +94,6 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddSymmetry.c,v 1.26 2009/02/19 16:23:54 fabio Exp $";
 #endif
 
-static  int     *entry;
-
-extern  int     ddTotalNumberSwapping;
 #ifdef DD_STATS
 extern  int     ddTotalNISwaps;
 #endif
@@ -111,7 +108,7 @@ extern  int     ddTotalNISwaps;
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
-static int ddSymmUniqueCompare (int *ptrX, int *ptrY);
+static int ddSymmUniqueCompare (IndexKey *ptrX, IndexKey *ptrY);
 static int ddSymmSiftingAux (DdManager *table, int x, int xLow, int xHigh);
 static int ddSymmSiftingConvAux (DdManager *table, int x, int xLow, int xHigh);
 static Move * ddSymmSiftingUp (DdManager *table, int y, int xLow);
@@ -325,7 +322,7 @@ cuddSymmSifting(
   int  upper)
 {
     int         i;
-    int         *var;
+    IndexKey    *var;
     int         size;
     int         x;
     int         result;
@@ -338,13 +335,7 @@ cuddSymmSifting(
     size = table->size;
 
     /* Find order in which to sift variables. */
-    var = NULL;
-    entry = ABC_ALLOC(int,size);
-    if (entry == NULL) {
-        table->errorCode = CUDD_MEMORY_OUT;
-        goto ddSymmSiftingOutOfMem;
-    }
-    var = ABC_ALLOC(int,size);
+    var = ABC_ALLOC(IndexKey,size);
     if (var == NULL) {
         table->errorCode = CUDD_MEMORY_OUT;
         goto ddSymmSiftingOutOfMem;
@@ -352,11 +343,11 @@ cuddSymmSifting(
 
     for (i = 0; i < size; i++) {
         x = table->perm[i];
-        entry[i] = table->subtables[x].keys;
-        var[i] = i;
+        var[i].index = i;
+        var[i].keys = table->subtables[x].keys;
     }
 
-    qsort((void *)var,(size_t)size,sizeof(int),(DD_QSFP)ddSymmUniqueCompare);
+    qsort((void *)var,(size_t)size,sizeof(IndexKey),(DD_QSFP)ddSymmUniqueCompare);
 
     /* Initialize the symmetry of each subtable to itself. */
     for (i = lower; i <= upper; i++) {
@@ -364,12 +355,12 @@ cuddSymmSifting(
     }
 
     for (i = 0; i < ddMin(table->siftMaxVar,size); i++) {
-        if (ddTotalNumberSwapping >= table->siftMaxSwap)
+        if (table->ddTotalNumberSwapping >= table->siftMaxSwap)
             break;
         // enable timeout during variable reodering - alanmi 2/13/11
         if ( table->TimeStop && Abc_Clock() > table->TimeStop )
             break;
-        x = table->perm[var[i]];
+        x = table->perm[var[i].index];
 #ifdef DD_STATS
         previousSize = table->keys - table->isolated;
 #endif
@@ -392,7 +383,6 @@ cuddSymmSifting(
     }
 
     ABC_FREE(var);
-    ABC_FREE(entry);
 
     ddSymmSummary(table, lower, upper, &symvars, &symgroups);
 
@@ -407,7 +397,6 @@ cuddSymmSifting(
 
 ddSymmSiftingOutOfMem:
 
-    if (entry != NULL) ABC_FREE(entry);
     if (var != NULL) ABC_FREE(var);
 
     return(0);
@@ -445,7 +434,7 @@ cuddSymmSiftingConv(
   int  upper)
 {
     int         i;
-    int         *var;
+    IndexKey    *var;
     int         size;
     int         x;
     int         result;
@@ -462,13 +451,7 @@ cuddSymmSiftingConv(
     size = table->size;
 
     /* Find order in which to sift variables. */
-    var = NULL;
-    entry = ABC_ALLOC(int,size);
-    if (entry == NULL) {
-        table->errorCode = CUDD_MEMORY_OUT;
-        goto ddSymmSiftingConvOutOfMem;
-    }
-    var = ABC_ALLOC(int,size);
+    var = ABC_ALLOC(IndexKey,size);
     if (var == NULL) {
         table->errorCode = CUDD_MEMORY_OUT;
         goto ddSymmSiftingConvOutOfMem;
@@ -476,11 +459,11 @@ cuddSymmSiftingConv(
 
     for (i = 0; i < size; i++) {
         x = table->perm[i];
-        entry[i] = table->subtables[x].keys;
-        var[i] = i;
+        var[i].index = i;
+        var[i].keys = table->subtables[x].keys;
     }
 
-    qsort((void *)var,(size_t)size,sizeof(int),(DD_QSFP)ddSymmUniqueCompare);
+    qsort((void *)var,(size_t)size,sizeof(IndexKey),(DD_QSFP)ddSymmUniqueCompare);
 
     /* Initialize the symmetry of each subtable to itself
     ** for first pass of converging symmetric sifting.
@@ -490,9 +473,9 @@ cuddSymmSiftingConv(
     }
 
     for (i = 0; i < ddMin(table->siftMaxVar, table->size); i++) {
-        if (ddTotalNumberSwapping >= table->siftMaxSwap)
+        if (table->ddTotalNumberSwapping >= table->siftMaxSwap)
             break;
-        x = table->perm[var[i]];
+        x = table->perm[var[i].index];
         if (x < lower || x > upper) continue;
         /* Only sift if not in symmetry group already. */
         if (table->subtables[x].next == (unsigned) x) {
@@ -531,17 +514,17 @@ cuddSymmSiftingConv(
             ** Hence, the next increment of x will move it to a new group.
             */
             i = table->invperm[x];
-            entry[i] = table->subtables[x].keys;
-            var[classes] = i;
+            var[classes].index = i;
+            var[classes].keys = table->subtables[x].keys;
         }
 
-        qsort((void *)var,(size_t)classes,sizeof(int),(DD_QSFP)ddSymmUniqueCompare);
+        qsort((void *)var,(size_t)classes,sizeof(IndexKey),(DD_QSFP)ddSymmUniqueCompare);
 
         /* Now sift. */
         for (i = 0; i < ddMin(table->siftMaxVar,classes); i++) {
-            if (ddTotalNumberSwapping >= table->siftMaxSwap)
+            if (table->ddTotalNumberSwapping >= table->siftMaxSwap)
                 break;
-            x = table->perm[var[i]];
+            x = table->perm[var[i].index];
             if ((unsigned) x >= table->subtables[x].next) {
 #ifdef DD_STATS
                 previousSize = table->keys - table->isolated;
@@ -573,13 +556,11 @@ cuddSymmSiftingConv(
 #endif
 
     ABC_FREE(var);
-    ABC_FREE(entry);
 
     return(1+symvars);
 
 ddSymmSiftingConvOutOfMem:
 
-    if (entry != NULL) ABC_FREE(entry);
     if (var != NULL) ABC_FREE(var);
 
     return(0);
@@ -606,15 +587,15 @@ ddSymmSiftingConvOutOfMem:
 ******************************************************************************/
 static int
 ddSymmUniqueCompare(
-  int * ptrX,
-  int * ptrY)
+  IndexKey * ptrX,
+  IndexKey * ptrY)
 {
 #if 0
-    if (entry[*ptrY] == entry[*ptrX]) {
-        return((*ptrX) - (*ptrY));
+    if (ptrY->keys == ptrX->keys) {
+        return(ptrX->index - ptrY->index);
     }
 #endif
-    return(entry[*ptrY] - entry[*ptrX]);
+    return(ptrY->keys - ptrX->keys);
 
 } /* end of ddSymmUniqueCompare */
 
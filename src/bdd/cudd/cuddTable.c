@@ -593,12 +593,14 @@ cuddInitTable(
     unique->countDead = ~0;
     unique->siftMaxVar = DD_SIFT_MAX_VAR;
     unique->siftMaxSwap = DD_SIFT_MAX_SWAPS;
+    unique->ddTotalNumberSwapping = 0;
     unique->tree = NULL;
     unique->treeZ = NULL;
     unique->groupcheck = CUDD_GROUP_CHECK7;
     unique->recomb = DD_DEFAULT_RECOMB;
     unique->symmviolation = 0;
     unique->arcviolation = 0;
+    unique->originalSize = 0;
     unique->populationSize = 0;
     unique->numberXovers = 0;
     unique->linear = NULL;
@@ -39,6 +39,7 @@ struct Llb_Img_t_
     DdManager *     ddR;            // BDD manager
     Vec_Ptr_t *     vDdMans;        // BDD managers for each partition
     Vec_Ptr_t *     vRings;         // onion rings in ddR
+    Llb_ImgPar_t *  pPar;           // threads computing partial images
 
     Vec_Int_t *     vDriRefs;       // driver references
     Vec_Int_t *     vVarsCs;        // cur state variables
@@ -145,7 +146,7 @@ Abc_Cex_t * Llb_CoreDeriveCex( Llb_Img_t * p )
             continue;
         // compute the next states
         bImage = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bState, 
-            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 1, 0, 0 );
+            vQuant0, vQuant1, p->vDriRefs, NULL, p->pPars->TimeTarget, 1, 0, 0 );
         assert( bImage != NULL );
         Cudd_Ref( bImage );
         Cudd_RecursiveDeref( p->dd, bState );
@@ -334,7 +335,7 @@ int Llb_CoreReachability_int( Llb_Img_t * p, Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQ
 
         // compute the next states
         bNext = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bCurrent, 
-            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 
+            vQuant0, vQuant1, p->vDriRefs, p->pPar, p->pPars->TimeTarget, 
             p->pPars->fBackward, p->pPars->fReorder, p->pPars->fVeryVerbose );
         if ( bNext == NULL )
         {
@@ -512,8 +513,14 @@ int Llb_CoreReachability( Llb_Img_t * p )
     Vec_VecFree( (Vec_Vec_t *)vSupps );
     // remove variables
     Llb_ImgQuantifyFirst( p->pAig, p->vDdMans, vQuant0, p->pPars->fVeryVerbose );
+    // copy the partitions into the managers of the threads
+    if ( p->pPars->nProcs > 1 )
+        p->pPar = Llb_ImgParStart( p->pAig, p->vDdMans, vQuant1, p->dd, p->pPars->nProcs );
     // perform reachability
     RetValue = Llb_CoreReachability_int( p, vQuant0, vQuant1 );
+    if ( p->pPar )
+        Llb_ImgParStop( p->pPar );
+    p->pPar = NULL;
     Vec_VecFree( (Vec_Vec_t *)vQuant0 );
     Vec_VecFree( (Vec_Vec_t *)vQuant1 );
     return RetValue;
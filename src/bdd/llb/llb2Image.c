@@ -20,6 +20,17 @@
 
 #include "llbInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -30,6 +41,24 @@ ABC_NAMESPACE_IMPL_START
 extern Vec_Ptr_t * Llb_ManCutNodes( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper );
 extern Vec_Ptr_t * Llb_ManCutRange( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper );
 
+#define LLB_THR_MAX 64
+
+typedef struct Llb_ImgThData_t_ Llb_ImgThData_t;
+struct Llb_ImgThData_t_
+{
+    DdManager *      dd;             // the manager owned by the thread
+    Vec_Ptr_t *      vParts;         // the partitions copied into this manager
+    Vec_Ptr_t *      vCubes;         // variables quantified after each partition
+    Vec_Ptr_t *      vStarts;        // the parts of the state set given to the thread
+    DdNode *         bImage;         // the partial image (NULL after timeout)
+};
+
+struct Llb_ImgPar_t_
+{
+    int              nProcs;         // the number of threads
+    Llb_ImgThData_t  ThData[LLB_THR_MAX];
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -350,6 +379,228 @@ void Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the managers for computing partial images.]
+
+  Description [Each thread owns a BDD manager with the copies of all
+  partitions (after quantifying the variables found in one partition)
+  and the cubes of variables quantified after each partition. The copies
+  are made once, using the current order of the main manager, and reused
+  in all iterations of reachability. Later, each manager is reordered 
+  by its thread independently of the main manager, because shuffling 
+  after each reordering of the main manager is too slow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Llb_ImgPar_t * Llb_ImgParStart( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vQuant1, DdManager * dd, int nProcs )
+{
+#ifdef ABC_USE_PTHREADS
+    Llb_ImgPar_t * p;
+    DdManager * ddPart;
+    DdNode * bFunc;
+    int i, k;
+    nProcs = Abc_MinInt( nProcs, LLB_THR_MAX );
+    if ( nProcs < 2 )
+        return NULL;
+    p = ABC_CALLOC( Llb_ImgPar_t, 1 );
+    p->nProcs = nProcs;
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Llb_ImgThData_t * pTh = p->ThData + k;
+        pTh->dd      = Cudd_Init( Cudd_ReadSize(dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        pTh->vParts  = Vec_PtrAlloc( Vec_PtrSize(vDdMans) );
+        pTh->vCubes  = Vec_PtrAlloc( Vec_PtrSize(vDdMans) );
+        pTh->vStarts = Vec_PtrAlloc( 4 );
+        Cudd_ShuffleHeap( pTh->dd, dd->invperm );
+        Cudd_AutodynEnable( pTh->dd, CUDD_REORDER_SYMM_SIFT );
+        Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
+        {
+            bFunc = Cudd_bddTransfer( ddPart, pTh->dd, ddPart->bFunc );                         Cudd_Ref( bFunc );
+            Vec_PtrPush( pTh->vParts, bFunc );
+            bFunc = Llb_ImgComputeCube( pAig, (Vec_Int_t *)Vec_PtrEntry(vQuant1, i+1), pTh->dd ); Cudd_Ref( bFunc );
+            Vec_PtrPush( pTh->vCubes, bFunc );
+        }
+    }
+    return p;
+#else
+    return NULL;
+#endif
+}
+void Llb_ImgParStop( Llb_ImgPar_t * p )
+{
+    DdNode * bFunc;
+    int i, k;
+    for ( k = 0; k < p->nProcs; k++ )
+    {
+        Llb_ImgThData_t * pTh = p->ThData + k;
+        Vec_PtrForEachEntry( DdNode *, pTh->vParts, bFunc, i )
+            Cudd_RecursiveDeref( pTh->dd, bFunc );
+        Vec_PtrForEachEntry( DdNode *, pTh->vCubes, bFunc, i )
+            Cudd_RecursiveDeref( pTh->dd, bFunc );
+        Vec_PtrFree( pTh->vParts );
+        Vec_PtrFree( pTh->vCubes );
+        Vec_PtrFree( pTh->vStarts );
+        Extra_StopManager( pTh->dd );
+    }
+    ABC_FREE( p );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the partial image in the manager of one thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Llb_ImgWorkerThread( void * pArg )
+{
+    Llb_ImgThData_t * p = (Llb_ImgThData_t *)pArg;
+    DdNode * bStart, * bImage, * bTemp;
+    int i, k;
+    p->bImage = Cudd_ReadLogicZero( p->dd );  Cudd_Ref( p->bImage );
+    Vec_PtrForEachEntry( DdNode *, p->vStarts, bStart, k )
+    {
+        bImage = bStart;  Cudd_Ref( bImage );
+        for ( i = 0; bImage && i < Vec_PtrSize(p->vParts); i++ )
+        {
+            bImage = Cudd_bddAndAbstract( p->dd, bTemp = bImage, (DdNode *)Vec_PtrEntry(p->vParts, i), (DdNode *)Vec_PtrEntry(p->vCubes, i) );
+            if ( bImage )
+                Cudd_Ref( bImage );
+            Cudd_RecursiveDeref( p->dd, bTemp );
+        }
+        if ( bImage == NULL )
+            break;
+        p->bImage = Cudd_bddOr( p->dd, bTemp = p->bImage, bImage );
+        if ( p->bImage )
+            Cudd_Ref( p->bImage );
+        Cudd_RecursiveDeref( p->dd, bTemp );
+        Cudd_RecursiveDeref( p->dd, bImage );
+        if ( p->bImage == NULL )
+            break;
+    }
+    if ( k < Vec_PtrSize(p->vStarts) && p->bImage )
+    {
+        Cudd_RecursiveDeref( p->dd, p->bImage );
+        p->bImage = NULL;
+    }
+    pthread_exit( NULL );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the product with the partitions using threads.]
+
+  Description [The state set is split into disjoint parts by the values 
+  of its top support variables. Since the product with the partitions
+  and quantification distribute over disjunction, the image is the 
+  disjunction of the partial images of the parts, computed by the threads
+  in their own managers and transferred back into the main manager.
+  Returns NULL (without dereferencing bImage) if timeout is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ImgComputeImagePar( Llb_ImgPar_t * p, DdManager * dd, DdNode * bImage, int fVerbose )
+{
+    pthread_t WorkerThread[LLB_THR_MAX];
+    DdNode * bSupp, * bVar, * bCube, * bPart, * bRes, * bTemp;
+    int pVars[16], nVars = 0, nParts, nStarts, i, k, status, fFail = 0;
+    abctime TimeStop, clk = Abc_Clock();
+    TimeStop = dd->TimeStop; dd->TimeStop = 0;
+    // collect the topmost support variables
+    bSupp = Cudd_Support( dd, bImage );  Cudd_Ref( bSupp );
+    for ( bVar = bSupp; !Cudd_IsConstant(bVar) && nVars < Abc_Base2Log(p->nProcs); bVar = cuddT(bVar) )
+        pVars[nVars++] = bVar->index;
+    Cudd_RecursiveDeref( dd, bSupp );
+    // divide the state set among the threads
+    nParts = (1 << nVars);
+    for ( i = 0; i < nParts; i++ )
+    {
+        Llb_ImgThData_t * pTh = p->ThData + i % p->nProcs;
+        bCube = Cudd_ReadOne( dd );  Cudd_Ref( bCube );
+        for ( k = 0; k < nVars; k++ )
+        {
+            bCube = Cudd_bddAnd( dd, bTemp = bCube, Cudd_NotCond(Cudd_bddIthVar(dd, pVars[k]), !((i >> k) & 1)) );  Cudd_Ref( bCube );
+            Cudd_RecursiveDeref( dd, bTemp );
+        }
+        bPart = Cudd_bddAnd( dd, bImage, bCube );                Cudd_Ref( bPart );
+        Cudd_RecursiveDeref( dd, bCube );
+        if ( bPart != Cudd_ReadLogicZero(dd) )
+        {
+            bTemp = Cudd_bddTransfer( dd, pTh->dd, bPart );      Cudd_Ref( bTemp );
+            Vec_PtrPush( pTh->vStarts, bTemp );
+        }
+        Cudd_RecursiveDeref( dd, bPart );
+    }
+    // compute partial images
+    for ( k = 0; k < p->nProcs; k++ )
+    {
+        Llb_ImgThData_t * pTh = p->ThData + k;
+        pTh->dd->TimeStop = TimeStop;
+        pTh->bImage = NULL;
+        if ( Vec_PtrSize(pTh->vStarts) == 0 )
+            continue;
+        status = pthread_create( WorkerThread + k, NULL, Llb_ImgWorkerThread, (void *)pTh );  assert( status == 0 );
+    }
+    for ( k = 0; k < p->nProcs; k++ )
+        if ( Vec_PtrSize(p->ThData[k].vStarts) > 0 )
+            pthread_join( WorkerThread[k], NULL );
+    // collect partial images in the main manager
+    bRes = Cudd_ReadLogicZero( dd );  Cudd_Ref( bRes );
+    for ( k = 0; k < p->nProcs; k++ )
+    {
+        Llb_ImgThData_t * pTh = p->ThData + k;
+        nStarts = Vec_PtrSize(pTh->vStarts);
+        Vec_PtrForEachEntry( DdNode *, pTh->vStarts, bTemp, i )
+            Cudd_RecursiveDeref( pTh->dd, bTemp );
+        Vec_PtrClear( pTh->vStarts );
+        if ( nStarts == 0 )
+            continue;
+        if ( pTh->bImage == NULL )
+        {
+            fFail = 1;
+            continue;
+        }
+        if ( !fFail )
+        {
+            bPart = Cudd_bddTransfer( pTh->dd, dd, pTh->bImage );  Cudd_Ref( bPart );
+            bRes  = Cudd_bddOr( dd, bTemp = bRes, bPart );         Cudd_Ref( bRes );
+            Cudd_RecursiveDeref( dd, bTemp );
+            Cudd_RecursiveDeref( dd, bPart );
+        }
+        Cudd_RecursiveDeref( pTh->dd, pTh->bImage );
+        pTh->bImage = NULL;
+    }
+    dd->TimeStop = TimeStop;
+    if ( fFail )
+    {
+        Cudd_RecursiveDeref( dd, bRes );
+        return NULL;
+    }
+    if ( fVerbose )
+    {
+        printf( "Threads = %d. Parts = %d. Image =%6d. ", p->nProcs, nParts, Cudd_DagSize(bRes) );
+        Abc_PrintTime( 1, "T", Abc_Clock() - clk );
+    }
+    Cudd_Deref( bRes );
+    return bRes;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Computes image of the initial set of states.]
@@ -362,7 +613,7 @@ void Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans )
 
 ***********************************************************************/
 DdNode * Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit, 
-    Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, 
+    Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, Llb_ImgPar_t * pPar, 
     abctime TimeTarget, int fBackward, int fReorder, int fVerbose )
 {
 //    int fCheckSupport = 0;
@@ -396,6 +647,17 @@ DdNode * Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager *
         Cudd_RecursiveDeref( dd, bCube );
     }
     // perform image computation
+#ifdef ABC_USE_PTHREADS
+    if ( pPar )
+    {
+        bImage = Llb_ImgComputeImagePar( pPar, dd, bTemp = bImage, fVerbose );
+        Cudd_RecursiveDeref( dd, bTemp );
+        if ( bImage == NULL )
+            return NULL;
+        Cudd_Ref( bImage );
+    }
+    else
+#endif
     Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
     {
         clk = Abc_Clock();
@@ -47,6 +47,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Llb_Man_t_ Llb_Man_t;
 typedef struct Llb_Mtr_t_ Llb_Mtr_t;
 typedef struct Llb_Grp_t_ Llb_Grp_t;
+typedef struct Llb_ImgPar_t_ Llb_ImgPar_t;
 
 struct Llb_Man_t_
 {
@@ -170,8 +171,10 @@ extern void            Llb_ImgSchedule( Vec_Ptr_t * vSupps, Vec_Ptr_t ** pvQuant
 extern DdManager *     Llb_ImgPartition( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper, abctime TimeTarget );
 extern void            Llb_ImgQuantifyFirst( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vQuant0, int fVerbose );
 extern void            Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans );
+extern Llb_ImgPar_t *  Llb_ImgParStart( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vQuant1, DdManager * dd, int nProcs );
+extern void            Llb_ImgParStop( Llb_ImgPar_t * p );
 extern DdNode *        Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit, 
-                           Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, 
+                           Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, Llb_ImgPar_t * pPar, 
                            abctime TimeTarget, int fBackward, int fReorder, int fVerbose );
 
 extern DdManager *     Llb_NonlinImageStart( Aig_Man_t * pAig, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vRoots, int * pVars2Q, int * pOrder, int fFirst, abctime TimeTarget );
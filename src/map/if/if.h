@@ -277,6 +277,12 @@ struct If_Man_t_
     int                nBestCutSmall[2];
     int                nCountNonDec[2];
     Vec_Int_t *        vCutData;      // cut data storage
+    Vec_Mem_t *        vAcdMem;       // ACD cache: truth tables with the decomposition parameters
+    Vec_Int_t *        vAcdRes;       // ACD cache: results (value, delay profile, cost)
+    word *             pAcdTemp;      // ACD cache: temporary entry
+    int                nAcdLoaded;    // ACD cache: entries loaded from file
+    int                nAcdCalls;     // ACD cache: the number of lookups
+    int                nAcdHits;      // ACD cache: the number of hits
     int                pArrTimeProfile[IF_MAX_FUNC_LUTSIZE];
     Vec_Ptr_t *        vVisited;
     void *             pUserMan;
@@ -567,6 +573,9 @@ extern int             If_CluCheckXXExt( void * p, word * pTruth, int nVars, int
                            char * pLut0, char * pLut1, word * pFunc0, word * pFunc1 );
 extern int             If_MatchCheck1( If_Man_t * p, unsigned * pTruth, int nVars, int nLeaves, char * pStr );
 extern int             If_MatchCheck2( If_Man_t * p, unsigned * pTruth, int nVars, int nLeaves, char * pStr );
+/*=== ifCache.c =============================================================*/
+extern int             If_ManAcdEvaluate( If_Man_t * p, word * pTruth, int nVars, int LutSize, int fAcd2, unsigned * pDelay, unsigned * pCost, int fNoLate );
+extern void            If_ManAcdCacheStop( If_Man_t * p );
 /*=== ifDelay.c =============================================================*/
 extern int             If_CutDelaySop( If_Man_t * p, If_Cut_t * pCut );
 extern int             If_CutSopBalanceEvalInt( Vec_Int_t * vCover, int * pTimes, int * pFaninLits, Vec_Int_t * vAig, int * piRes, int nSuppAll, int * pArea );
@@ -18,8 +18,16 @@
 
 ***********************************************************************/
 
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
 #include "if.h"
 #include "misc/vec/vecHsh.h"
+#include "base/main/main.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -91,6 +99,151 @@ void If_ManCacheAnalize( If_Man_t * p )
     Vec_IntFree( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Cache of the results of Ashenhurst-Curtis decomposition.]
+
+  Description [The results of ACD evaluation only depend on the truth table
+  of the cut, the mask of late-arriving inputs, and the parameters. Since
+  many cuts in a design share their functions, the results are hashed, so
+  that each function is evaluated once per run. Each entry of the cache is
+  the key word (the number of variables, the LUT size, the flags, and the
+  mask of late-arriving inputs) followed by the truth table padded with zeros.
+  If the flag "acdcache" is set to a file name, the cache is loaded from
+  this file before the first lookup and saved into it when the mapper stops,
+  so that the results are reused across runs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word If_ManAcdKey( int nVars, int LutSize, int fAcd2, int fNoLate, unsigned Mask )
+{
+    return (word)nVars | ((word)LutSize << 8) | ((word)fAcd2 << 16) | ((word)fNoLate << 17) | ((word)Mask << 32);
+}
+static void If_ManAcdCacheLoad( If_Man_t * p, char * pFileName )
+{
+    char pHeader[8];
+    int i, nVars, nEntries = 0, pRes[3];
+    int nWordsMax = Vec_MemEntrySize(p->vAcdMem) - 1;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return;
+    if ( fread( pHeader, 1, 8, pFile ) != 8 || memcmp(pHeader, "ABCACDC1", 8) || fread( &nEntries, sizeof(int), 1, pFile ) != 1 )
+    {
+        printf( "The ACD cache file \"%s\" has unknown format.\n", pFileName );
+        fclose( pFile );
+        return;
+    }
+    for ( i = 0; i < nEntries; i++ )
+    {
+        memset( p->pAcdTemp, 0, sizeof(word) * (nWordsMax + 1) );
+        if ( fread( p->pAcdTemp, sizeof(word), 1, pFile ) != 1 )
+            break;
+        nVars = (int)(p->pAcdTemp[0] & 0xFF);
+        if ( nVars > IF_MAX_FUNC_LUTSIZE )
+            break;
+        if ( Abc_Truth6WordNum(nVars) > nWordsMax ) // saved with a larger LUT size
+        {
+            if ( fseek( pFile, sizeof(word) * Abc_Truth6WordNum(nVars) + sizeof(int) * 3, SEEK_CUR ) )
+                break;
+            continue;
+        }
+        if ( fread( p->pAcdTemp + 1, sizeof(word), Abc_Truth6WordNum(nVars), pFile ) != (size_t)Abc_Truth6WordNum(nVars) )
+            break;
+        if ( fread( pRes, sizeof(int), 3, pFile ) != 3 )
+            break;
+        if ( Vec_MemHashInsert(p->vAcdMem, p->pAcdTemp) < Vec_IntSize(p->vAcdRes) / 3 )
+            continue;
+        Vec_IntPushThree( p->vAcdRes, pRes[0], pRes[1], pRes[2] );
+    }
+    if ( i < nEntries )
+        printf( "The ACD cache file \"%s\" is truncated.\n", pFileName );
+    fclose( pFile );
+    p->nAcdLoaded = Vec_MemEntryNum( p->vAcdMem );
+}
+static void If_ManAcdCacheSave( If_Man_t * p, char * pFileName )
+{
+    char * pTemp = ABC_ALLOC( char, strlen(pFileName) + 32 );
+    word * pEntry;
+    int i, nVars, nEntries = Vec_MemEntryNum( p->vAcdMem );
+    FILE * pFile;
+    sprintf( pTemp, "%s.tmp%d_%d", pFileName, (int)getpid(), (int)Abc_Clock() & 0xFFFF );
+    pFile = fopen( pTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing the ACD cache.\n", pTemp );
+        ABC_FREE( pTemp );
+        return;
+    }
+    fwrite( "ABCACDC1", 1, 8, pFile );
+    fwrite( &nEntries, sizeof(int), 1, pFile );
+    Vec_MemForEachEntry( p->vAcdMem, pEntry, i )
+    {
+        nVars = (int)(pEntry[0] & 0xFF);
+        fwrite( pEntry, sizeof(word), 1 + Abc_Truth6WordNum(nVars), pFile );
+        fwrite( Vec_IntEntryP(p->vAcdRes, 3*i), sizeof(int), 3, pFile );
+    }
+    fclose( pFile );
+    if ( rename( pTemp, pFileName ) )
+    {
+        printf( "Cannot rename file \"%s\" into \"%s\".\n", pTemp, pFileName );
+        remove( pTemp );
+    }
+    ABC_FREE( pTemp );
+}
+static void If_ManAcdCacheStart( If_Man_t * p )
+{
+    int nWords = Abc_Truth6WordNum( p->pPars->nLutSize );
+    assert( p->vAcdMem == NULL );
+    p->vAcdMem  = Vec_MemAlloc( nWords + 1, 12 );
+    Vec_MemHashAlloc( p->vAcdMem, 10000 );
+    p->vAcdRes  = Vec_IntAlloc( 3 * 10000 );
+    p->pAcdTemp = ABC_CALLOC( word, nWords + 1 );
+    if ( Abc_FrameReadFlag("acdcache") )
+        If_ManAcdCacheLoad( p, Abc_FrameReadFlag("acdcache") );
+}
+void If_ManAcdCacheStop( If_Man_t * p )
+{
+    if ( p->vAcdMem == NULL )
+        return;
+    if ( p->pPars->fVerbose )
+        printf( "ACD cache: Lookups = %d. Hits = %d. (%6.2f %%)  Entries = %d. Loaded = %d.\n", 
+            p->nAcdCalls, p->nAcdHits, 100.0 * p->nAcdHits / Abc_MaxInt(1, p->nAcdCalls), Vec_MemEntryNum(p->vAcdMem), p->nAcdLoaded );
+    if ( Abc_FrameReadFlag("acdcache") && Vec_MemEntryNum(p->vAcdMem) > p->nAcdLoaded )
+        If_ManAcdCacheSave( p, Abc_FrameReadFlag("acdcache") );
+    Vec_MemHashFree( p->vAcdMem );
+    Vec_MemFreeP( &p->vAcdMem );
+    Vec_IntFreeP( &p->vAcdRes );
+    ABC_FREE( p->pAcdTemp );
+}
+int If_ManAcdEvaluate( If_Man_t * p, word * pTruth, int nVars, int LutSize, int fAcd2, unsigned * pDelay, unsigned * pCost, int fNoLate )
+{
+    int iEntry, Value;
+    if ( p->vAcdMem == NULL )
+        If_ManAcdCacheStart( p );
+    assert( nVars <= p->pPars->nLutSize );
+    p->nAcdCalls++;
+    memset( p->pAcdTemp, 0, sizeof(word) * Vec_MemEntrySize(p->vAcdMem) );
+    p->pAcdTemp[0] = If_ManAcdKey( nVars, LutSize, fAcd2, fNoLate, *pDelay );
+    Abc_TtCopy( p->pAcdTemp + 1, pTruth, Abc_Truth6WordNum(nVars), 0 );
+    iEntry = Vec_MemHashInsert( p->vAcdMem, p->pAcdTemp );
+    if ( iEntry < Vec_IntSize(p->vAcdRes) / 3 )
+    {
+        p->nAcdHits++;
+        *pDelay = (unsigned)Vec_IntEntry( p->vAcdRes, 3*iEntry+1 );
+        *pCost  = (unsigned)Vec_IntEntry( p->vAcdRes, 3*iEntry+2 );
+        return Vec_IntEntry( p->vAcdRes, 3*iEntry );
+    }
+    if ( fAcd2 )
+        Value = acd2_evaluate( pTruth, nVars, LutSize, pDelay, pCost, fNoLate );
+    else
+        Value = acd_evaluate( pTruth, nVars, LutSize, pDelay, pCost, fNoLate );
+    Vec_IntPushThree( p->vAcdRes, Value, (int)*pDelay, (int)*pCost );
+    return Value;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
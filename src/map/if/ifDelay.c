@@ -490,7 +490,7 @@ int If_LutDecEval( If_Man_t * p, If_Cut_t * pCut, If_Obj_t * pObj, int optDelay,
 
     /* returns the delay of the decomposition */
     word *pTruth = If_CutTruthW( p, pCut );
-    int val = acd_evaluate( pTruth, pCut->nLeaves, LutSize, &uLeafMask, &cost, !use_late_arrival );
+    int val = If_ManAcdEvaluate( p, pTruth, pCut->nLeaves, LutSize, 0, &uLeafMask, &cost, !use_late_arrival );
 
     /* not feasible decomposition */
     pCut->decDelay = uLeafMask;
@@ -580,7 +580,7 @@ int If_Lut2DecEval( If_Man_t * p, If_Cut_t * pCut, If_Obj_t * pObj, int optDelay
 
     /* returns the delay of the decomposition */
     word *pTruth = If_CutTruthW( p, pCut );
-    int val = acd2_evaluate( pTruth, pCut->nLeaves, LutSize, &uLeafMask, &cost, !use_late_arrival );
+    int val = If_ManAcdEvaluate( p, pTruth, pCut->nLeaves, LutSize, 1, &uLeafMask, &cost, !use_late_arrival );
 
     /* not feasible decomposition */
     pCut->decDelay = uLeafMask;
@@ -207,15 +207,15 @@ int Map_SuperLibDeriveFromGenlib( Mio_Library_t * pLib, int fVerbose )
     if ( pLib == NULL )
         return 0;
 
-    // compute supergates
-    vStr = Super_PrecomputeStr( pLib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 0 );
+    // compute supergates (or load them from the cache)
+    vStr = Super_PrecomputeStrCached( pLib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 0 );
     if ( vStr == NULL )
         return 0;
 
     // create supergate library
     pFileName = Extra_FileNameGenericAppend( Mio_LibraryReadName(pLib), ".super" );
     pLibSuper = Map_SuperLibCreate( pLib, vStr, pFileName, NULL, 1, 0 );
-    Vec_StrFree( vStr );
+    Super_CacheFree( vStr );
 
     // replace the library
     Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
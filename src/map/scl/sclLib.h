@@ -92,6 +92,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads used for timing
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -237,6 +238,8 @@ struct SC_Lib_
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
+    Vec_Ptr_t *    vCorners;       // Vec<SC_Lib>      -- additional timing corners with the same cell footprints
+    Vec_Int_t *    vCornerMap;     // Vec<int>         -- (corner only) maps cell IDs of the primary library into cell IDs of this one
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -449,7 +452,15 @@ static inline void Abc_SclLibFree( SC_Lib * p )
     SC_WireLoadSel * pWLS;
     SC_TableTempl * pTempl;
     SC_Cell * pCell;
+    SC_Lib * pCorner;
     int i;
+    if ( p->vCorners )
+    {
+        Vec_PtrForEachEntry( SC_Lib *, p->vCorners, pCorner, i )
+            Abc_SclLibFree( pCorner );
+        Vec_PtrFree( p->vCorners );
+    }
+    Vec_IntFreeP( &p->vCornerMap );
     SC_LibForEachWireLoad( p, pWL, i )
         Abc_SclWireLoadFree( pWL );
     Vec_PtrErase( &p->vWireLoads );
@@ -523,6 +534,63 @@ static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 
     return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
 }
+/**Function*************************************************************
+
+  Synopsis    [Batched lookup table delay computation.]
+
+  Description [Evaluates nLookups table lookups at once.  The search for
+  the sample points is done for each lookup, while the interpolation is
+  performed in a separate loop over the arrays, which the compiler can 
+  vectorize.  The results are the same as those of Scl_LibLookup().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SCL_LOOKUP_BATCH 64
+static inline void Scl_LibLookupBatch( SC_Surface ** ppSurfs, float * pSlews, float * pLoads, float * pRes, int nLookups )
+{
+    float P00[SCL_LOOKUP_BATCH], P01[SCL_LOOKUP_BATCH], P10[SCL_LOOKUP_BATCH], P11[SCL_LOOKUP_BATCH];
+    float SFrac[SCL_LOOKUP_BATCH], LFrac[SCL_LOOKUP_BATCH];
+    float * pIndex0, * pIndex1, * pDataS, * pDataS1, p0, p1;
+    SC_Surface * p;
+    int i, s, l;
+    assert( nLookups <= SCL_LOOKUP_BATCH );
+    for ( i = 0; i < nLookups; i++ )
+    {
+        p = ppSurfs[i];
+        // handle constant table
+        if ( Vec_FltSize(&p->vIndex0) == 1 && Vec_FltSize(&p->vIndex1) == 1 )
+        {
+            P00[i] = P01[i] = P10[i] = P11[i] = Vec_FltEntry( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, 0), 0 );
+            SFrac[i] = LFrac[i] = 0;
+            continue;
+        }
+        pIndex0 = Vec_FltArray(&p->vIndex0);
+        for ( s = 1; s < Vec_FltSize(&p->vIndex0)-1; s++ )
+            if ( pIndex0[s] > pSlews[i] )
+                break;
+        s--;
+        pIndex1 = Vec_FltArray(&p->vIndex1);
+        for ( l = 1; l < Vec_FltSize(&p->vIndex1)-1; l++ )
+            if ( pIndex1[l] > pLoads[i] )
+                break;
+        l--;
+        SFrac[i] = (pSlews[i] - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+        LFrac[i] = (pLoads[i] - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+        pDataS   = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s) );
+        pDataS1  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1) );
+        P00[i] = pDataS [l];  P01[i] = pDataS [l+1];
+        P10[i] = pDataS1[l];  P11[i] = pDataS1[l+1];
+    }
+    for ( i = 0; i < nLookups; i++ )
+    {
+        p0 = P00[i] + LFrac[i] * (P01[i] - P00[i]);
+        p1 = P10[i] + LFrac[i] * (P11[i] - P10[i]);
+        pRes[i] = p0 + SFrac[i] * (p1 - p0);
+    }
+}
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
@@ -741,7 +809,7 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 }
 
 /*=== sclLiberty.c ===============================================================*/
-extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use );
+extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int nProcs, int fVerbose, int fVeryVerbose, SC_DontUse dont_use );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
@@ -755,6 +823,7 @@ extern int           Abc_SclCellFind( SC_Lib * p, char * pName );
 extern int           Abc_SclClassCellNum( SC_Cell * pClass );
 extern void          Abc_SclShortNames( SC_Lib * p );
 extern int           Abc_SclLibClassNum( SC_Lib * pLib );
+extern int           Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner );
 extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
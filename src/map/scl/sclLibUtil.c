@@ -101,6 +101,73 @@ int Abc_SclLibClassNum( SC_Lib * pLib )
     return Count;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds another timing corner to the library.]
+
+  Description [The corner library should contain a cell with the same
+  name and the same pin order for each cell of the primary library.
+  Cells of the primary library are mapped into the cells of the corner
+  by name. Returns 1 if the corner was added; otherwise, the corner
+  library is not changed and the caller remains its owner.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner )
+{
+    SC_Cell * pCell, * pCell2;
+    SC_Pin * pPin;
+    Vec_Int_t * vMap;
+    int i, k, iCell;
+    assert( p->vCornerMap == NULL && pCorner->vCornerMap == NULL );
+    if ( pCorner->vCorners && Vec_PtrSize(pCorner->vCorners) )
+    {
+        printf( "The corner library \"%s\" has its own corners.\n", pCorner->pName );
+        return 0;
+    }
+    if ( p->unit_time != pCorner->unit_time || p->unit_cap_fst != pCorner->unit_cap_fst || p->unit_cap_snd != pCorner->unit_cap_snd )
+    {
+        printf( "The corner library \"%s\" has different units.\n", pCorner->pName );
+        return 0;
+    }
+    vMap = Vec_IntAlloc( SC_LibCellNum(p) );
+    SC_LibForEachCell( p, pCell, i )
+    {
+        iCell = Abc_SclCellFind( pCorner, pCell->pName );
+        if ( iCell == -1 )
+        {
+            printf( "Cell \"%s\" is not found in the corner library \"%s\".\n", pCell->pName, pCorner->pName );
+            Vec_IntFree( vMap );
+            return 0;
+        }
+        pCell2 = SC_LibCell( pCorner, iCell );
+        if ( pCell2->n_inputs != pCell->n_inputs || pCell2->n_outputs != pCell->n_outputs )
+        {
+            printf( "Cell \"%s\" has different pins in the corner library \"%s\".\n", pCell->pName, pCorner->pName );
+            Vec_IntFree( vMap );
+            return 0;
+        }
+        SC_CellForEachPin( pCell, pPin, k )
+            if ( strcmp(pPin->pName, SC_CellPin(pCell2, k)->pName) )
+                break;
+        if ( k < pCell->n_inputs + pCell->n_outputs )
+        {
+            printf( "Cell \"%s\" has different pin order in the corner library \"%s\".\n", pCell->pName, pCorner->pName );
+            Vec_IntFree( vMap );
+            return 0;
+        }
+        Vec_IntPush( vMap, iCell );
+    }
+    pCorner->vCornerMap = vMap;
+    if ( p->vCorners == NULL )
+        p->vCorners = Vec_PtrAlloc( 4 );
+    Vec_PtrPush( p->vCorners, pCorner );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Change cell names and pin names.]
@@ -23,6 +23,20 @@
 #pragma comment(lib, "shlwapi.lib")
 #else 
 #include <fnmatch.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
 #endif
 
 #include "sclLib.h"
@@ -78,6 +92,15 @@ struct Scl_Tree_t_
     char *          pError;       // the error string
     abctime         clkStart;     // beginning time
     Vec_Str_t *     vBuffer;      // temp string buffer
+    int             fMapped;      // the contents are memory-mapped
+    int             fSkipUnused;  // skips the groups not used by SCL
+    Vec_Int_t *     vDefer;       // cells whose bodies are parsed later (item ID, line)
+};
+
+// the groups skipped when only the data needed by SCL is extracted
+static char * s_SclLibertyUnused[] = {
+    "internal_power", "output_current_", "receiver_capacitance", "ccsn_", "dynamic_current", "intrinsic_parasitic",
+    "leakage_current", "normalized_driver_waveform", "input_ccb", "output_ccb", "pg_pin", NULL
 };
 
 
@@ -357,6 +380,26 @@ static inline Scl_Item_t * Scl_LibertyNewItem( Scl_Tree_t * p, int Type )
     p->pItems[p->nItems].Next  = -1;
     return p->pItems + p->nItems++;
 }
+// returns 1 if the group is not used by SCL
+static inline int Scl_LibertyIsUnused( Scl_Tree_t * p, Scl_Pair_t Key )
+{
+    int i, nLength;
+    for ( i = 0; s_SclLibertyUnused[i]; i++ )
+    {
+        nLength = strlen( s_SclLibertyUnused[i] );
+        if ( Key.End - Key.Beg >= nLength && !strncmp( p->pContents+Key.Beg, s_SclLibertyUnused[i], nLength ) )
+            return 1;
+    }
+    return 0;
+}
+// counts the lines in the skipped part of the file
+static inline int Scl_LibertyCountLines( char * pBeg, char * pEnd )
+{
+    int Counter = 0;
+    for ( ; pBeg < pEnd; pBeg++ )
+        Counter += (*pBeg == '\n');
+    return Counter;
+}
 
 
 /**Function*************************************************************
@@ -478,15 +521,32 @@ int Scl_LibertyBuildItem( Scl_Tree_t * p, char ** ppPos, char * pEnd )
             pStop = Scl_LibertyFindMatch( pNext, pEnd );
             Body.Beg = pNext - p->pContents + 1;
             Body.End = pStop - p->pContents;
+            // skip the group if it is not needed
+            if ( p->fSkipUnused && Scl_LibertyIsUnused(p, Key) )
+            {
+                p->nLines += Scl_LibertyCountLines( pNext, pStop );
+                *ppPos = pStop + 1;
+                return Scl_LibertyBuildItem( p, ppPos, pEnd );
+            }
             // end of body
             pItem = Scl_LibertyNewItem( p, SCL_LIBERTY_PROC );
             pItem->Key  = Key;
             pItem->Head = Scl_LibertyUpdateHead( p, Head );
             pItem->Body = Body;
-            *ppPos = pNext + 1;
-            pItem->Child = Scl_LibertyBuildItem( p, ppPos, pStop );
-            if ( pItem->Child == -1 )
-                goto exit;
+            if ( p->vDefer && !Scl_LibertyCompare(p, Key, "cell") )
+            {
+                // the body of the cell is parsed later by Scl_LibertyBuildDeferred()
+                Vec_IntPushTwo( p->vDefer, Scl_LibertyItemId(p, pItem), p->nLines );
+                p->nLines += Scl_LibertyCountLines( pNext, pStop );
+                pItem->Child = -2;
+            }
+            else
+            {
+                *ppPos = pNext + 1;
+                pItem->Child = Scl_LibertyBuildItem( p, ppPos, pStop );
+                if ( pItem->Child == -1 )
+                    goto exit;
+            }
             *ppPos = pStop + 1;
             pItem->Next = Scl_LibertyBuildItem( p, ppPos, pEnd );
             if ( pItem->Next == -1 )
@@ -562,6 +622,34 @@ char * Scl_LibertyFileContents( char * pFileName, long nContents )
     pContents[nContents] = 0;
     return pContents;
 }
+// maps the file into memory; the pages modified by the parser are private to the process
+char * Scl_LibertyFileMap( char * pFileName, long nContents )
+{
+#ifndef _WIN32
+    char * pContents;
+    int fd;
+    // the parser expects the terminating zero, which is available only if the last page is not full
+    if ( nContents % sysconf(_SC_PAGESIZE) == 0 )
+        return NULL;
+    fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    pContents = (char *)mmap( NULL, (size_t)nContents + 1, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+    assert( pContents[nContents] == 0 );
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Scl_LibertyFileUnmap( char * pContents, long nContents )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nContents + 1 );
+#endif
+}
 void Scl_LibertyStringDump( char * pFileName, Vec_Str_t * vStr )
 {
     FILE * pFile = fopen( pFileName, "wb" );
@@ -600,7 +688,10 @@ Scl_Tree_t * Scl_LibertyStart( char * pFileName )
     memset( p, 0, sizeof(Scl_Tree_t) );
     p->clkStart  = Abc_Clock();
     p->nContents = RetValue;
-    p->pContents = Scl_LibertyFileContents( pFileName, p->nContents );
+    p->pContents = Scl_LibertyFileMap( pFileName, p->nContents );
+    p->fMapped   = (p->pContents != NULL);
+    if ( p->pContents == NULL )
+        p->pContents = Scl_LibertyFileContents( pFileName, p->nContents );
     // other 
     p->pFileName = Abc_UtilStrsav( pFileName );
     p->nItermAlloc = 10 + Scl_LibertyCountItems( p->pContents, p->pContents+p->nContents );
@@ -618,21 +709,196 @@ void Scl_LibertyStop( Scl_Tree_t * p, int fVerbose )
         ABC_PRT( "Time", Abc_Clock() - p->clkStart );
     }
     Vec_StrFree( p->vBuffer );
+    Vec_IntFreeP( &p->vDefer );
     ABC_FREE( p->pFileName );
-    ABC_FREE( p->pContents );
+    if ( p->fMapped )
+        Scl_LibertyFileUnmap( p->pContents, p->nContents );
+    else
+        ABC_FREE( p->pContents );
     ABC_FREE( p->pItems );
     ABC_FREE( p->pError );
     ABC_FREE( p );
 }
-Scl_Tree_t * Scl_LibertyParse( char * pFileName, int fVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the bodies of the cells deferred by the main pass.]
+
+  Description [Cells from iStart to iStop are parsed into the local tree,
+  which shares the file contents with the main tree.  The children of each
+  cell are stored in its Child field using local item IDs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Scl_Tree_t * Scl_LibertyBuildDeferred( Scl_Tree_t * p, int iStart, int iStop )
+{
+    Scl_Tree_t * pLoc;
+    Scl_Item_t * pCell;
+    char * pPos;
+    int i, nItems = 10;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pCell   = Scl_LibertyItem( p, Vec_IntEntry(p->vDefer, 2*i) );
+        nItems += Scl_LibertyCountItems( p->pContents + pCell->Body.Beg, p->pContents + pCell->Body.End );
+    }
+    pLoc = ABC_CALLOC( Scl_Tree_t, 1 );
+    pLoc->pFileName   = p->pFileName;
+    pLoc->pContents   = p->pContents;
+    pLoc->nContents   = p->nContents;
+    pLoc->fSkipUnused = p->fSkipUnused;
+    pLoc->nItermAlloc = nItems;
+    pLoc->pItems      = ABC_CALLOC( Scl_Item_t, pLoc->nItermAlloc );
+    pLoc->vBuffer     = Vec_StrStart( 10 );
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pCell = Scl_LibertyItem( p, Vec_IntEntry(p->vDefer, 2*i) );
+        pPos  = p->pContents + pCell->Body.Beg;
+        pLoc->nLines = Vec_IntEntry(p->vDefer, 2*i+1);
+        pCell->Child = Scl_LibertyBuildItem( pLoc, &pPos, p->pContents + pCell->Body.End );
+        if ( pCell->Child == -1 )
+            break;
+    }
+    return pLoc;
+}
+void Scl_LibertyMergeDeferred( Scl_Tree_t * p, Scl_Tree_t * pLoc, int iStart, int iStop )
+{
+    Scl_Item_t * pItem;
+    int i, Base = p->nItems;
+    assert( p->nItems + pLoc->nItems <= p->nItermAlloc );
+    memcpy( p->pItems + Base, pLoc->pItems, sizeof(Scl_Item_t) * pLoc->nItems );
+    for ( i = 0; i < pLoc->nItems; i++ )
+    {
+        pItem = p->pItems + Base + i;
+        if ( pItem->Next >= 0 )
+            pItem->Next += Base;
+        if ( pItem->Child >= 0 )
+            pItem->Child += Base;
+    }
+    p->nItems += pLoc->nItems;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pItem = Scl_LibertyItem( p, Vec_IntEntry(p->vDefer, 2*i) );
+        if ( pItem->Child >= 0 )
+            pItem->Child += Base;
+    }
+    if ( p->pError == NULL )
+        p->pError = pLoc->pError, pLoc->pError = NULL;
+    ABC_FREE( pLoc->pError );
+    ABC_FREE( pLoc->pItems );
+    Vec_StrFree( pLoc->vBuffer );
+    ABC_FREE( pLoc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the deferred cells using several threads.]
+
+  Description [The cells are divided into nProcs chunks of similar size.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SCL_THR_MAX 64
+typedef struct Scl_LibertyThData_t_
+{
+    Scl_Tree_t * p;
+    Scl_Tree_t * pLoc;
+    int          iStart;
+    int          iStop;
+} Scl_LibertyThData_t;
+
+void * Scl_LibertyWorkerThread( void * pArg )
+{
+    Scl_LibertyThData_t * pThData = (Scl_LibertyThData_t *)pArg;
+    pThData->pLoc = Scl_LibertyBuildDeferred( pThData->p, pThData->iStart, pThData->iStop );
+    return NULL;
+}
+void Scl_LibertyParseDeferred( Scl_Tree_t * p, int nProcs )
+{
+    Scl_LibertyThData_t ThData[SCL_THR_MAX];
+    Scl_Item_t * pCell;
+    long nBytes = 0, nLimit;
+    int i, k, nCells = Vec_IntSize(p->vDefer) / 2;
+    nProcs = Abc_MinInt( Abc_MaxInt(nProcs, 1), Abc_MinInt(SCL_THR_MAX, Abc_MaxInt(nCells, 1)) );
+    // divide the cells into chunks with roughly the same number of bytes
+    for ( i = 0; i < nCells; i++ )
+        nBytes += Scl_LibertyItem( p, Vec_IntEntry(p->vDefer, 2*i) )->Body.End - Scl_LibertyItem( p, Vec_IntEntry(p->vDefer, 2*i) )->Body.Beg;
+    ThData[0].iStart = 0;
+    for ( i = k = 0, nLimit = nBytes / nProcs, nBytes = 0; i < nCells && k < nProcs - 1; i++ )
+    {
+        pCell   = Scl_LibertyItem( p, Vec_IntEntry(p->vDefer, 2*i) );
+        nBytes += pCell->Body.End - pCell->Body.Beg;
+        if ( nBytes >= nLimit * (k + 1) )
+            ThData[k].iStop = i + 1, ThData[++k].iStart = i + 1;
+    }
+    ThData[k].iStop = nCells;
+    nProcs = k + 1;
+    for ( i = 0; i < nProcs; i++ )
+        ThData[i].p = p, ThData[i].pLoc = NULL;
+#ifdef ABC_USE_PTHREADS
+    if ( nProcs > 1 )
+    {
+        pthread_t WorkerThread[SCL_THR_MAX];
+        int status;
+        for ( i = 0; i < nProcs; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Scl_LibertyWorkerThread, (void *)(ThData + i) );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nProcs; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );
+            assert( status == 0 );
+        }
+    }
+    else
+#endif
+    for ( i = 0; i < nProcs; i++ )
+        Scl_LibertyWorkerThread( (void *)(ThData + i) );
+    // merge the local trees in the original order of cells
+    for ( i = 0; i < nProcs; i++ )
+        Scl_LibertyMergeDeferred( p, ThData[i].pLoc, ThData[i].iStart, ThData[i].iStop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the Liberty file.]
+
+  Description [If nProcs is more than one, the main pass builds only the 
+  top-level items, while the bodies of the cells are parsed concurrently.
+  If fSkipUnused is set, the groups not needed by SCL (power, CCS, noise)
+  are not added to the tree.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Scl_Tree_t * Scl_LibertyParse( char * pFileName, int nProcs, int fSkipUnused, int fVerbose )
 {
     Scl_Tree_t * p;
     char * pPos;
+    int Root;
     if ( (p = Scl_LibertyStart(pFileName)) == NULL )
         return NULL;
+    p->fSkipUnused = fSkipUnused;
+    if ( nProcs > 1 )
+        p->vDefer = Vec_IntAlloc( 1000 );
     pPos = p->pContents;
     Scl_LibertyWipeOutComments( p->pContents, p->pContents+p->nContents );
-    if ( (!Scl_LibertyBuildItem( p, &pPos, p->pContents + p->nContents )) == 0 )
+    Root = Scl_LibertyBuildItem( p, &pPos, p->pContents + p->nContents );
+    if ( Root == 0 && p->vDefer && Vec_IntSize(p->vDefer) > 0 )
+    {
+        Scl_LibertyParseDeferred( p, nProcs );
+        if ( p->pError )
+            Root = -1;
+    }
+    if ( Root != 0 )
     {
         if ( p->pError ) printf( "%s", p->pError );
         printf( "Parsing failed.  " );
@@ -1702,12 +1968,12 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int nProcs, int fVerbose, int fVeryVerbose, SC_DontUse dont_use )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    p = Scl_LibertyParse( pFileName, nProcs, 1, fVeryVerbose );
     if ( p == NULL )
         return NULL;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
@@ -1746,7 +2012,7 @@ void Scl_LibertyTest()
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
 //    return;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    p = Scl_LibertyParse( pFileName, 1, 0, fVeryVerbose );
     if ( p == NULL )
         return;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
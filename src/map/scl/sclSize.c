@@ -175,6 +175,8 @@ void Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath )
     Abc_Print( 1, "(%5.1f %%)   ",         100.0 * Abc_SclCountNearCriticalNodes(p) / Abc_NtkNodeNum(p->pNtk) );
     Abc_Print( 1, "            \n" );
 #endif
+    if ( p->nCorners )
+        Abc_SclTimeCornersPrint( p );
 
     if ( fShowAll )
     {
@@ -296,6 +298,11 @@ static inline void Abc_SclDeptObj( SC_Man * p, Abc_Obj_t * pObj )
     SC_Timing * pTime;
     Abc_Obj_t * pFanout;
     int i;
+    if ( p->nCorners )
+    {
+        Abc_SclDeptObjCorners( p, pObj );
+        return;
+    }
     SC_PairClean( Abc_SclObjDept(p, pObj) );
     Abc_ObjForEachFanout( pObj, pFanout, i )
     {
@@ -324,7 +331,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
-    int k;
+    int k, fChange;
     SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
     float LoadRise = pLoad->rise;
     float LoadFall = pLoad->fall;
@@ -336,6 +343,8 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
     {
         assert( !fDept );
         Abc_SclTimeCi( p, pObj );
+        if ( p->nCorners )
+            Abc_SclTimeCiCorners( p, pObj );
         return;
     }
     if ( Abc_ObjIsCo(pObj) )
@@ -343,12 +352,22 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         if ( !fDept )
         {
             Abc_SclObjDupFanin( p, pObj );
+            if ( p->nCorners )
+                Abc_SclTimeCoCorners( p, pObj );
             Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
             Vec_QueUpdate( p->vQue, pObj->iData );
         }
         return;
     }
     assert( Abc_ObjIsNode(pObj) );
+    if ( p->nCorners )
+    {
+        if ( fDept )
+            Abc_SclDeptObjCorners( p, pObj );
+        else
+            p->nEstNodes += Abc_SclTimeNodeCorners( p, pObj, &fChange );
+        return;
+    }
 //    if ( !(Abc_ObjFaninNum(pObj) == 1 && Abc_ObjIsPi(Abc_ObjFanin0(pObj))) && p->EstLoadMax && Value > 1 )
     if ( p->EstLoadMax && Value > 1 )
     {
@@ -422,8 +441,13 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->nProcs > 1 && p->pFuncFanin == NULL )
+        Abc_SclTimeNtkArrivalPar( p, p->nProcs );
+    else
+    {
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
     Abc_NtkForEachCo( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     D = Abc_SclReadMaxDelay( p );
@@ -438,6 +462,9 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
         p->nEstNodes = 0;
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
             Abc_SclTimeNode( p, pObj, 1 );
+        if ( p->nCorners )
+            Abc_NtkForEachCi( p->pNtk, pObj, i )
+                Abc_SclDeptObjCorners( p, pObj );
     }
 }
 
@@ -499,7 +526,7 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
     SC_Pair * pArrOut, *pSlewOut;
     Abc_Obj_t * pObj;
     float E = (float)0.1;
-    int i, k;
+    int i, k, fChange;
     Vec_WecForEachLevel( p->vLevels, vLevel, i )
     {
         Abc_NtkForEachObjVec( vLevel, p->pNtk, pObj, k )
@@ -507,10 +534,19 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
             if ( Abc_ObjIsCo(pObj) )
             {
                 Abc_SclObjDupFanin( p, pObj );
+                if ( p->nCorners )
+                    Abc_SclTimeCoCorners( p, pObj );
                 Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
                 Vec_QueUpdate( p->vQue, pObj->iData );
                 continue;
             }
+            if ( p->nCorners && Abc_ObjIsNode(pObj) )
+            {
+                p->nEstNodes += Abc_SclTimeNodeCorners( p, pObj, &fChange );
+                if ( fChange )
+                    Abc_SclTimeIncAddFanouts( p, pObj );
+                continue;
+            }
             pArrOut  = Abc_SclObjTime( p, pObj );
             pSlewOut = Abc_SclObjSlew( p, pObj );
             SC_PairMove( &ArrOut,  pArrOut  );
@@ -645,9 +681,10 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nProcs = nProcs;
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -683,10 +720,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nProcs );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -704,12 +741,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nProcs );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -914,7 +951,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
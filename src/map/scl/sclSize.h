@@ -72,6 +72,13 @@ struct SC_Man_
     float          EstLoadAve;    // average load of the gate
     float          EstLinear;     // linear coefficient
     int            nEstNodes;     // the number of estimations
+    int            nProcs;        // the number of threads used for timing
+    // multiple corners
+    int            nCorners;      // the number of timing corners (0 if only one library is used)
+    SC_Lib **      pCorners;      // libraries of the corners (the first one is pLib)
+    SC_Pair *      pTimesC;       // arrivals for each corner (corner-major)
+    SC_Pair *      pSlewsC;       // slews for each corner (corner-major)
+    SC_Pair *      pDeptsC;       // departures for each corner (corner-major)
     // intermediate data
     Vec_Que_t *    vNodeByGain;   // nodes by gain
     Vec_Flt_t *    vNode2Gain;    // mapping node into its gain
@@ -116,6 +123,11 @@ static inline SC_Pair * Abc_SclObjDept( SC_Man * p, Abc_Obj_t * pObj )
 static inline SC_Pair * Abc_SclObjTime( SC_Man * p, Abc_Obj_t * pObj )              { return p->pTimes + Abc_ObjId(pObj);  }
 static inline SC_Pair * Abc_SclObjSlew( SC_Man * p, Abc_Obj_t * pObj )              { return p->pSlews + Abc_ObjId(pObj);  }
 
+static inline SC_Pair * Abc_SclObjTimeC( SC_Man * p, Abc_Obj_t * pObj, int c )     { return p->pTimesC + c * p->nObjs + Abc_ObjId(pObj);  }
+static inline SC_Pair * Abc_SclObjSlewC( SC_Man * p, Abc_Obj_t * pObj, int c )     { return p->pSlewsC + c * p->nObjs + Abc_ObjId(pObj);  }
+static inline SC_Pair * Abc_SclObjDeptC( SC_Man * p, Abc_Obj_t * pObj, int c )     { return p->pDeptsC + c * p->nObjs + Abc_ObjId(pObj);  }
+static inline SC_Cell * Abc_SclObjCellC( SC_Man * p, Abc_Obj_t * pObj, int c )     { return c ? SC_LibCell(p->pCorners[c], Vec_IntEntry(p->pCorners[c]->vCornerMap, Abc_SclObjCellId(pObj))) : Abc_SclObjCell(pObj); }
+
 static inline double    Abc_SclObjLoadMax( SC_Man * p, Abc_Obj_t * pObj )           { return Abc_MaxFloat(Abc_SclObjLoad(p, pObj)->rise, Abc_SclObjLoad(p, pObj)->fall);  }
 static inline float     Abc_SclObjLoadAve( SC_Man * p, Abc_Obj_t * pObj )           { return 0.5 * Abc_SclObjLoad(p, pObj)->rise + 0.5 * Abc_SclObjLoad(p, pObj)->fall;   }
 static inline double    Abc_SclObjTimeOne( SC_Man * p, Abc_Obj_t * pObj, int fRise ){ return fRise ? Abc_SclObjTime(p, pObj)->rise : Abc_SclObjTime(p, pObj)->fall;       }
@@ -181,6 +193,18 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->vNodeIter   = Vec_IntStartFull( p->nObjs );
     p->vLevels     = Vec_WecStart( 2 * Abc_NtkLevel(pNtk) + 1 );
     p->vChanged    = Vec_IntAlloc( 100 );
+    // timing corners
+    if ( pLib->vCorners && Vec_PtrSize(pLib->vCorners) )
+    {
+        p->nCorners    = 1 + Vec_PtrSize(pLib->vCorners);
+        p->pCorners    = ABC_ALLOC( SC_Lib *, p->nCorners );
+        p->pCorners[0] = pLib;
+        for ( i = 1; i < p->nCorners; i++ )
+            p->pCorners[i] = (SC_Lib *)Vec_PtrEntry( pLib->vCorners, i-1 );
+        p->pTimesC     = ABC_CALLOC( SC_Pair, p->nCorners * p->nObjs );
+        p->pSlewsC     = ABC_CALLOC( SC_Pair, p->nCorners * p->nObjs );
+        p->pDeptsC     = ABC_CALLOC( SC_Pair, p->nCorners * p->nObjs );
+    }
     Abc_NtkForEachCo( pNtk, pObj, i )
         pObj->Level = Abc_ObjFanin0(pObj)->Level + 1;
     // set CI/CO ids
@@ -227,6 +251,10 @@ static inline void Abc_SclManFree( SC_Man * p )
     ABC_FREE( p->pDepts );
     ABC_FREE( p->pTimes );
     ABC_FREE( p->pSlews );
+    ABC_FREE( p->pCorners );
+    ABC_FREE( p->pTimesC );
+    ABC_FREE( p->pSlewsC );
+    ABC_FREE( p->pDeptsC );
     ABC_FREE( p );
 }
 /*
@@ -259,6 +287,12 @@ static inline void Abc_SclManCleanTime( SC_Man * p )
     memset( p->pTimes, 0, sizeof(SC_Pair) * p->nObjs );
     memset( p->pSlews, 0, sizeof(SC_Pair) * p->nObjs );
     memset( p->pDepts, 0, sizeof(SC_Pair) * p->nObjs );
+    if ( p->nCorners )
+    {
+        memset( p->pTimesC, 0, sizeof(SC_Pair) * p->nCorners * p->nObjs );
+        memset( p->pSlewsC, 0, sizeof(SC_Pair) * p->nCorners * p->nObjs );
+        memset( p->pDeptsC, 0, sizeof(SC_Pair) * p->nCorners * p->nObjs );
+    }
 /*
     if ( p->pPiDrive != NULL )
     {
@@ -340,7 +374,7 @@ static inline void Abc_SclLoadRestore3( SC_Man * p, Abc_Obj_t * pObj )
 static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
-    int i;
+    int i, c;
     Vec_FltClear( p->vTimes2 );
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
@@ -349,11 +383,19 @@ static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->rise );
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->fall );
     }
+    for ( c = 0; c < p->nCorners; c++ )
+    Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
+    {
+        Vec_FltPush( p->vTimes2, Abc_SclObjTimeC(p, pObj, c)->rise );
+        Vec_FltPush( p->vTimes2, Abc_SclObjTimeC(p, pObj, c)->fall );
+        Vec_FltPush( p->vTimes2, Abc_SclObjSlewC(p, pObj, c)->rise );
+        Vec_FltPush( p->vTimes2, Abc_SclObjSlewC(p, pObj, c)->fall );
+    }
 }
 static inline void Abc_SclConeRestore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
-    int i, k = 0;
+    int i, c, k = 0;
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
         Abc_SclObjTime(p, pObj)->rise = Vec_FltEntry(p->vTimes2, k++);
@@ -361,6 +403,14 @@ static inline void Abc_SclConeRestore( SC_Man * p, Vec_Int_t * vCone )
         Abc_SclObjSlew(p, pObj)->rise = Vec_FltEntry(p->vTimes2, k++);
         Abc_SclObjSlew(p, pObj)->fall = Vec_FltEntry(p->vTimes2, k++);
     }
+    for ( c = 0; c < p->nCorners; c++ )
+    Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
+    {
+        Abc_SclObjTimeC(p, pObj, c)->rise = Vec_FltEntry(p->vTimes2, k++);
+        Abc_SclObjTimeC(p, pObj, c)->fall = Vec_FltEntry(p->vTimes2, k++);
+        Abc_SclObjSlewC(p, pObj, c)->rise = Vec_FltEntry(p->vTimes2, k++);
+        Abc_SclObjSlewC(p, pObj, c)->fall = Vec_FltEntry(p->vTimes2, k++);
+    }
     assert( Vec_FltSize(p->vTimes2) == k );
 }
 static inline void Abc_SclEvalStore( SC_Man * p, Vec_Int_t * vCone )
@@ -560,17 +610,25 @@ extern void          Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubt
 extern void          Abc_SclComputeLoad( SC_Man * p );
 extern void          Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew );
 extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout );
+/*=== sclSta.c ================================================================*/
+extern Vec_Wec_t *   Abc_SclTimeLevelize( Abc_Ntk_t * pNtk );
+extern void          Abc_SclTimeNtkArrivalPar( SC_Man * p, int nProcs );
+extern void          Abc_SclTimeCiCorners( SC_Man * p, Abc_Obj_t * pObj );
+extern void          Abc_SclTimeCoCorners( SC_Man * p, Abc_Obj_t * pObj );
+extern int           Abc_SclTimeNodeCorners( SC_Man * p, Abc_Obj_t * pObj, int * pfChange );
+extern void          Abc_SclDeptObjCorners( SC_Man * p, Abc_Obj_t * pObj );
+extern void          Abc_SclTimeCornersPrint( SC_Man * p );
 /*=== sclSize.c ===============================================================*/
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
-extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
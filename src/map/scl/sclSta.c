@@ -0,0 +1,477 @@
+/**CFile****************************************************************
+
+  FileName    [sclSta.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Levelized multithreaded static timing analysis.]
+
+  Author      [Alan Mishchenko, Niklas Een]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: sclSta.c,v 1.0 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <math.h>
+#include "sclSize.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SCL_THR_MAX       64     // the max number of threads
+#define SCL_LEVEL_MIN    256     // levels with fewer nodes are processed by the main thread
+
+typedef struct Scl_StaThData_t_ Scl_StaThData_t;
+struct Scl_StaThData_t_
+{
+    SC_Man *     p;              // the timing manager
+    Vec_Int_t *  vLevel;         // the nodes of the current level
+    int          iStart;         // the first node of this thread
+    int          iStop;          // the last node of this thread
+    int          nEstNodes;      // the number of nodes with estimated load
+    int          fWorking;       // the thread is processing the level
+    int          fStop;          // the thread should exit
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the arrival time and slew of one internal node.]
+
+  Description [Performs the same computation as Abc_SclTimeNode() with
+  fDept = 0 for the given cell, arrays of arrival times and slews, and
+  the load, but only writes into the timing data of pObj, so that the
+  nodes of one level can be processed concurrently.  The table lookups
+  of all fanins are evaluated in one batch.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclTimeNodeBatchInt( Abc_Obj_t * pObj, SC_Cell * pCell, SC_Pair * pTimes, SC_Pair * pSlews, SC_Pair * pLoad )
+{
+    SC_Surface * pSurfs[SCL_LOOKUP_BATCH];
+    float pSlewsIn[SCL_LOOKUP_BATCH], pLoads[SCL_LOOKUP_BATCH], pRes[SCL_LOOKUP_BATCH];
+    float pArrs[SCL_LOOKUP_BATCH];
+    SC_Pair * pArrOut  = pTimes + Abc_ObjId(pObj);
+    SC_Pair * pSlewOut = pSlews + Abc_ObjId(pObj);
+    SC_Timing * pTime;
+    SC_Pair * pArrIn, * pSlewIn;
+    Abc_Obj_t * pFanin;
+    int k, n = 0, nLookups = 0;
+    // collect the lookups for all fanins
+    Abc_ObjForEachFanin( pObj, pFanin, k )
+    {
+        if ( nLookups + 8 > SCL_LOOKUP_BATCH )
+        {
+            Scl_LibLookupBatch( pSurfs, pSlewsIn, pLoads, pRes, nLookups );
+            for ( n = 0; n < nLookups; n += 4 )
+            {
+                pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrs[n+0] + pRes[n+0] );
+                pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrs[n+1] + pRes[n+1] );
+                pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,               pRes[n+2] );
+                pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,               pRes[n+3] );
+            }
+            nLookups = 0;
+        }
+        pTime   = Scl_CellPinTime( pCell, k );
+        pArrIn  = pTimes + Abc_ObjId(pFanin);
+        pSlewIn = pSlews + Abc_ObjId(pFanin);
+        if ( pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non )
+        {
+            pSurfs[nLookups] = &pTime->pCellRise;  pSlewsIn[nLookups] = pSlewIn->rise;  pLoads[nLookups] = pLoad->rise;  pArrs[nLookups++] = pArrIn->rise;
+            pSurfs[nLookups] = &pTime->pCellFall;  pSlewsIn[nLookups] = pSlewIn->fall;  pLoads[nLookups] = pLoad->fall;  pArrs[nLookups++] = pArrIn->fall;
+            pSurfs[nLookups] = &pTime->pRiseTrans; pSlewsIn[nLookups] = pSlewIn->rise;  pLoads[nLookups] = pLoad->rise;  pArrs[nLookups++] = 0;
+            pSurfs[nLookups] = &pTime->pFallTrans; pSlewsIn[nLookups] = pSlewIn->fall;  pLoads[nLookups] = pLoad->fall;  pArrs[nLookups++] = 0;
+        }
+        if ( pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non )
+        {
+            pSurfs[nLookups] = &pTime->pCellRise;  pSlewsIn[nLookups] = pSlewIn->fall;  pLoads[nLookups] = pLoad->rise;  pArrs[nLookups++] = pArrIn->fall;
+            pSurfs[nLookups] = &pTime->pCellFall;  pSlewsIn[nLookups] = pSlewIn->rise;  pLoads[nLookups] = pLoad->fall;  pArrs[nLookups++] = pArrIn->rise;
+            pSurfs[nLookups] = &pTime->pRiseTrans; pSlewsIn[nLookups] = pSlewIn->fall;  pLoads[nLookups] = pLoad->rise;  pArrs[nLookups++] = 0;
+            pSurfs[nLookups] = &pTime->pFallTrans; pSlewsIn[nLookups] = pSlewIn->rise;  pLoads[nLookups] = pLoad->fall;  pArrs[nLookups++] = 0;
+        }
+    }
+    // evaluate the lookups and update the arrival times and slews
+    Scl_LibLookupBatch( pSurfs, pSlewsIn, pLoads, pRes, nLookups );
+    for ( n = 0; n < nLookups; n += 4 )
+    {
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrs[n+0] + pRes[n+0] );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrs[n+1] + pRes[n+1] );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,               pRes[n+2] );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,               pRes[n+3] );
+    }
+}
+static inline float Abc_SclTimeNodeLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Pair * pLoad )
+{
+    float Value = p->EstLoadMax ? (0.5 * Abc_SclObjLoad(p, pObj)->fall + 0.5 * Abc_SclObjLoad(p, pObj)->rise) / (p->EstLoadAve * p->EstLoadMax) : 0;
+    *pLoad = *Abc_SclObjLoad( p, pObj );
+    if ( !(p->EstLoadMax && Value > 1) )
+        return 0;
+    pLoad->rise = pLoad->fall = p->EstLoadAve * p->EstLoadMax;
+    return Value;
+}
+static inline int Abc_SclTimeNodeBatch( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair Load, * pArrOut;
+    float Value, EstDelta;
+    int fChange;
+    if ( p->nCorners )
+        return Abc_SclTimeNodeCorners( p, pObj, &fChange );
+    Value = Abc_SclTimeNodeLoad( p, pObj, &Load );
+    Abc_SclTimeNodeBatchInt( pObj, Abc_SclObjCell(pObj), p->pTimes, p->pSlews, &Load );
+    if ( Value <= 1 )
+        return 0;
+    EstDelta = p->EstLinear * log( Value );
+    pArrOut  = Abc_SclObjTime( p, pObj );
+    pArrOut->rise += EstDelta;
+    pArrOut->fall += EstDelta;
+    return 1;
+}
+static inline int Abc_SclTimeNodesBatch( SC_Man * p, Vec_Int_t * vLevel, int iStart, int iStop )
+{
+    int i, nEstNodes = 0;
+    for ( i = iStart; i < iStop; i++ )
+        nEstNodes += Abc_SclTimeNodeBatch( p, Abc_NtkObj(p->pNtk, Vec_IntEntry(vLevel, i)) );
+    return nEstNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes timing of one object in all corners.]
+
+  Description [The arrival times and slews of each corner are propagated
+  using the cell of that corner, while the load is shared by all corners.
+  The main arrays of arrival times and slews are set to the worst values
+  across the corners, so that the sizing engines, which only look at the
+  main arrays, optimize the worst-corner slack.  Abc_SclTimeNodeCorners()
+  returns 1 if the load of the node was estimated; *pfChange is set to 1
+  if the timing of some corner has changed.  If the fanin callback is
+  given, it updates the load seen by each fanin in the same way as in
+  Abc_SclTimeFanin().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclTimeObjCornersWorst( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair * pArrOut  = Abc_SclObjTime( p, pObj );
+    SC_Pair * pSlewOut = Abc_SclObjSlew( p, pObj );
+    int c;
+    *pArrOut  = *Abc_SclObjTimeC( p, pObj, 0 );
+    *pSlewOut = *Abc_SclObjSlewC( p, pObj, 0 );
+    for ( c = 1; c < p->nCorners; c++ )
+    {
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  Abc_SclObjTimeC(p, pObj, c)->rise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  Abc_SclObjTimeC(p, pObj, c)->fall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise, Abc_SclObjSlewC(p, pObj, c)->rise );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall, Abc_SclObjSlewC(p, pObj, c)->fall );
+    }
+}
+void Abc_SclTimeCiCorners( SC_Man * p, Abc_Obj_t * pObj )
+{
+    int c;
+    assert( Abc_ObjIsCi(pObj) );
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        *Abc_SclObjTimeC( p, pObj, c ) = *Abc_SclObjTime( p, pObj );
+        *Abc_SclObjSlewC( p, pObj, c ) = *Abc_SclObjSlew( p, pObj );
+    }
+}
+void Abc_SclTimeCoCorners( SC_Man * p, Abc_Obj_t * pObj )
+{
+    int c;
+    assert( Abc_ObjIsCo(pObj) );
+    for ( c = 0; c < p->nCorners; c++ )
+        *Abc_SclObjTimeC( p, pObj, c ) = *Abc_SclObjTimeC( p, Abc_ObjFanin0(pObj), c );
+}
+static inline void Abc_SclTimeNodeCornerFanins( SC_Man * p, Abc_Obj_t * pObj, int c, SC_Pair * pLoad )
+{
+    SC_Cell * pCell = Abc_SclObjCellC( p, pObj, c );
+    SC_Pair Load = *pLoad;
+    Abc_Obj_t * pFanin;
+    int k;
+    Abc_ObjForEachFanin( pObj, pFanin, k )
+    {
+        Load.fall += p->pFuncFanin(p, pObj, pFanin, k, 0);
+        Load.rise += p->pFuncFanin(p, pObj, pFanin, k, 1);
+        Scl_LibPinArrival( Scl_CellPinTime(pCell, k), Abc_SclObjTimeC(p, pFanin, c), Abc_SclObjSlewC(p, pFanin, c), &Load, Abc_SclObjTimeC(p, pObj, c), Abc_SclObjSlewC(p, pObj, c) );
+    }
+}
+int Abc_SclTimeNodeCorners( SC_Man * p, Abc_Obj_t * pObj, int * pfChange )
+{
+    float E = (float)0.1;
+    SC_Pair Load, ArrOut, SlewOut;
+    SC_Pair * pArrOut, * pSlewOut;
+    float Value = Abc_SclTimeNodeLoad( p, pObj, &Load );
+    float EstDelta = Value > 1 ? p->EstLinear * log( Value ) : 0;
+    int c;
+    assert( Abc_ObjIsNode(pObj) );
+    *pfChange = 0;
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        pArrOut  = Abc_SclObjTimeC( p, pObj, c );
+        pSlewOut = Abc_SclObjSlewC( p, pObj, c );
+        SC_PairMove( &ArrOut,  pArrOut  );
+        SC_PairMove( &SlewOut, pSlewOut );
+        if ( p->pFuncFanin )
+            Abc_SclTimeNodeCornerFanins( p, pObj, c, &Load );
+        else
+            Abc_SclTimeNodeBatchInt( pObj, Abc_SclObjCellC(p, pObj, c), p->pTimesC + c * p->nObjs, p->pSlewsC + c * p->nObjs, &Load );
+        pArrOut->rise += EstDelta;
+        pArrOut->fall += EstDelta;
+        if ( !SC_PairEqualE(&ArrOut, pArrOut, E) || !SC_PairEqualE(&SlewOut, pSlewOut, E) )
+            *pfChange = 1;
+    }
+    Abc_SclTimeObjCornersWorst( p, pObj );
+    return Value > 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes departure times of one object in all corners.]
+
+  Description [Collects the departure times from the fanouts.  The main
+  array of departure times is set so that the sum of the arrival and
+  departure time is the worst one across the corners.  The fanin callback,
+  if given, updates the load of the fanout as in Abc_SclDeptFanin().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclDeptObjCorners( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair Load, DepOut;
+    SC_Pair * pDept = Abc_SclObjDept( p, pObj );
+    SC_Pair * pTime = Abc_SclObjTime( p, pObj );
+    Abc_Obj_t * pFanout;
+    float Value, EstDelta;
+    int i, c, k;
+    for ( c = 0; c < p->nCorners; c++ )
+        SC_PairClean( Abc_SclObjDeptC(p, pObj, c) );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( Abc_ObjIsCo(pFanout) || Abc_ObjIsLatch(pFanout) )
+            continue;
+        k = Abc_NodeFindFanin( pFanout, pObj );
+        Value = Abc_SclTimeNodeLoad( p, pFanout, &Load );
+        EstDelta = Value > 1 ? p->EstLinear * log( Value ) : 0;
+        if ( p->pFuncFanin ) Load.fall += p->pFuncFanin(p, pFanout, pObj, k, 0);
+        if ( p->pFuncFanin ) Load.rise += p->pFuncFanin(p, pFanout, pObj, k, 1);
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            DepOut = *Abc_SclObjDeptC( p, pFanout, c );
+            DepOut.rise += EstDelta;
+            DepOut.fall += EstDelta;
+            Scl_LibPinDeparture( Scl_CellPinTime(Abc_SclObjCellC(p, pFanout, c), k), Abc_SclObjDeptC(p, pObj, c), Abc_SclObjSlewC(p, pObj, c), &Load, &DepOut );
+        }
+    }
+    SC_PairClean( pDept );
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        pDept->rise = Abc_MaxFloat( pDept->rise, Abc_SclObjTimeC(p, pObj, c)->rise + Abc_SclObjDeptC(p, pObj, c)->rise - pTime->rise );
+        pDept->fall = Abc_MaxFloat( pDept->fall, Abc_SclObjTimeC(p, pObj, c)->fall + Abc_SclObjDeptC(p, pObj, c)->fall - pTime->fall );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the delay of each corner.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeCornersPrint( SC_Man * p )
+{
+    Abc_Obj_t * pObj;
+    float Delay;
+    int i, c;
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        Delay = 0;
+        Abc_NtkForEachCo( p->pNtk, pObj, i )
+        {
+            Delay = Abc_MaxFloat( Delay, Abc_SclObjTimeC(p, pObj, c)->rise );
+            Delay = Abc_MaxFloat( Delay, Abc_SclObjTimeC(p, pObj, c)->fall );
+        }
+        Abc_Print( 1, "Corner %d : Delay =%9.2f ps  (%s)\n", c, Delay, p->pCorners[c]->pName );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Groups the internal nodes by their logic level.]
+
+  Description [The levels are recomputed here because the levels stored
+  in the nodes are not exact during incremental sizing.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Abc_SclTimeLevelize( Abc_Ntk_t * pNtk )
+{
+    Vec_Int_t * vLevels = Vec_IntStart( Abc_NtkObjNumMax(pNtk) );
+    Vec_Wec_t * vNodes  = Vec_WecAlloc( 100 );
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level;
+    Abc_NtkForEachNode1( pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Abc_ObjId(pFanin)) );
+        Vec_IntWriteEntry( vLevels, i, Level + 1 );
+        Vec_WecPush( vNodes, Level, i );
+    }
+    Vec_IntFree( vLevels );
+    return vNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival times of internal nodes using several threads.]
+
+  Description [Assumes that the timing of the CIs is already computed.
+  The levels are processed in a topological order.  The nodes of each
+  level are divided among the threads, while the main thread takes the
+  first chunk and waits until other threads are done.  Small levels are
+  processed by the main thread alone.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Abc_SclTimeNtkArrivalPar( SC_Man * p, int nProcs )
+{
+    Vec_Wec_t * vNodes = Abc_SclTimeLevelize( p->pNtk );
+    Vec_Int_t * vLevel;
+    int i;
+    Vec_WecForEachLevel( vNodes, vLevel, i )
+        p->nEstNodes += Abc_SclTimeNodesBatch( p, vLevel, 0, Vec_IntSize(vLevel) );
+    Vec_WecFree( vNodes );
+}
+
+#else // pthreads are used
+
+void * Abc_SclTimeWorkerThread( void * pArg )
+{
+    Scl_StaThData_t * pThData = (Scl_StaThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->fStop )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        pThData->nEstNodes += Abc_SclTimeNodesBatch( pThData->p, pThData->vLevel, pThData->iStart, pThData->iStop );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+void Abc_SclTimeNtkArrivalPar( SC_Man * p, int nProcs )
+{
+    Scl_StaThData_t ThData[SCL_THR_MAX];
+    pthread_t WorkerThread[SCL_THR_MAX];
+    Vec_Wec_t * vNodes = Abc_SclTimeLevelize( p->pNtk );
+    Vec_Int_t * vLevel;
+    int i, k, nChunk, status;
+    nProcs = Abc_MinInt( nProcs, SCL_THR_MAX );
+    // start the threads (thread 0 is the main thread)
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Scl_StaThData_t) );
+        ThData[i].p = p;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, Abc_SclTimeWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    // process the levels
+    Vec_WecForEachLevel( vNodes, vLevel, i )
+    {
+        if ( Vec_IntSize(vLevel) < SCL_LEVEL_MIN || nProcs < 2 )
+        {
+            p->nEstNodes += Abc_SclTimeNodesBatch( p, vLevel, 0, Vec_IntSize(vLevel) );
+            continue;
+        }
+        nChunk = (Vec_IntSize(vLevel) + nProcs - 1) / nProcs;
+        for ( k = nProcs - 1; k >= 0; k-- )
+        {
+            ThData[k].vLevel = vLevel;
+            ThData[k].iStart = Abc_MinInt( k * nChunk, Vec_IntSize(vLevel) );
+            ThData[k].iStop  = Abc_MinInt( (k + 1) * nChunk, Vec_IntSize(vLevel) );
+            if ( k > 0 )
+                ThData[k].fWorking = 1;
+        }
+        ThData[0].nEstNodes += Abc_SclTimeNodesBatch( p, vLevel, ThData[0].iStart, ThData[0].iStop );
+        // wait till threads finish
+        for ( k = 1; k < nProcs; k++ )
+            if ( ((volatile int *)&ThData[k].fWorking)[0] )
+                k = 0;
+    }
+    // stop the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        p->nEstNodes += ThData[i].nEstNodes;
+        if ( i == 0 )
+            continue;
+        assert( !ThData[i].fWorking );
+        ThData[i].fStop = 1;
+        ThData[i].fWorking = 1;
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    Vec_WecFree( vNodes );
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
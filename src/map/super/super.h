@@ -48,6 +48,13 @@ ABC_NAMESPACE_HEADER_START
 
 /*=== superAnd.c =============================================================*/
 extern void        Super2_Precompute( int nInputs, int nLevels, int fVerbose );
+/*=== superCache.c ===========================================================*/
+extern word        Super_CacheHash( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv );
+extern char *      Super_CacheFileName( Mio_Library_t * pLibGen, word Hash );
+extern Vec_Str_t * Super_CacheLoad( char * pFileName, word Hash );
+extern int         Super_CacheSave( char * pFileName, word Hash, Vec_Str_t * vStr );
+extern void        Super_CacheFree( Vec_Str_t * vStr );
+extern Vec_Str_t * Super_PrecomputeStrCached( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose );
 /*=== superGate.c =============================================================*/
 extern Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose );
 extern void        Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose, char * pFileName );
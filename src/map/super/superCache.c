@@ -0,0 +1,329 @@
+/**CFile****************************************************************
+
+  FileName    [superCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Pre-computation of supergates.]
+
+  Synopsis    [Binary cache of precomputed supergate libraries.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: superCache.c,v 1.0 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "superInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache file is a fixed-size header followed by the text produced by
+// Super_PrecomputeStr().  The text is handed to the mapper as it is stored
+// in the file, so on systems with mmap() it is never copied into memory.
+
+#define SUPER_CACHE_MAGIC    "ABCSUPC"
+#define SUPER_CACHE_VERSION  1
+
+typedef struct Super_CacheHead_t_ Super_CacheHead_t;
+struct Super_CacheHead_t_
+{
+    char                Magic[8];     // SUPER_CACHE_MAGIC
+    int                 Version;      // SUPER_CACHE_VERSION
+    int                 Reserved;     // unused
+    word                Hash;         // the hash of the library and the parameters
+    word                nSize;        // the number of bytes in the text
+};
+
+static inline word Super_CacheHashData( word Hash, void * pData, int nBytes )
+{
+    unsigned char * p = (unsigned char *)pData;
+    int i;
+    for ( i = 0; i < nBytes; i++ )
+        Hash = (Hash ^ p[i]) * ABC_CONST(0x100000001B3);
+    return Hash;
+}
+static inline word Super_CacheHashStr( word Hash, char * pStr )
+{
+    return pStr ? Super_CacheHashData( Hash, pStr, strlen(pStr) + 1 ) : Super_CacheHashData( Hash, (char *)"", 1 );
+}
+static inline word Super_CacheHashDouble( word Hash, double Value )
+{
+    return Super_CacheHashData( Hash, &Value, sizeof(double) );
+}
+static inline word Super_CacheHashInt( word Hash, int Value )
+{
+    return Super_CacheHashData( Hash, &Value, sizeof(int) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cache key of the library and the parameters.]
+
+  Description [The key covers everything that influences the result of
+  Super_PrecomputeStr(): the library name, the gate names, areas, formulas,
+  pin parameters, and the precomputation limits.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Super_CacheHash( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv )
+{
+    Mio_Gate_t * pGate;
+    Mio_Pin_t * pPin;
+    word Hash = ABC_CONST(0xCBF29CE484222325);
+    Hash = Super_CacheHashInt( Hash, SUPER_CACHE_VERSION );
+    Hash = Super_CacheHashStr( Hash, Mio_LibraryReadName(pLibGen) );
+    Mio_LibraryForEachGate( pLibGen, pGate )
+    {
+        Hash = Super_CacheHashStr( Hash, Mio_GateReadName(pGate) );
+        Hash = Super_CacheHashStr( Hash, Mio_GateReadOutName(pGate) );
+        Hash = Super_CacheHashStr( Hash, Mio_GateReadForm(pGate) );
+        Hash = Super_CacheHashDouble( Hash, Mio_GateReadArea(pGate) );
+        Mio_GateForEachPin( pGate, pPin )
+        {
+            Hash = Super_CacheHashStr( Hash, Mio_PinReadName(pPin) );
+            Hash = Super_CacheHashInt( Hash, (int)Mio_PinReadPhase(pPin) );
+            Hash = Super_CacheHashDouble( Hash, Mio_PinReadInputLoad(pPin) );
+            Hash = Super_CacheHashDouble( Hash, Mio_PinReadMaxLoad(pPin) );
+            Hash = Super_CacheHashDouble( Hash, Mio_PinReadDelayBlockRise(pPin) );
+            Hash = Super_CacheHashDouble( Hash, Mio_PinReadDelayFanoutRise(pPin) );
+            Hash = Super_CacheHashDouble( Hash, Mio_PinReadDelayBlockFall(pPin) );
+            Hash = Super_CacheHashDouble( Hash, Mio_PinReadDelayFanoutFall(pPin) );
+        }
+    }
+    Hash = Super_CacheHashInt( Hash, nVarsMax );
+    Hash = Super_CacheHashInt( Hash, nLevels );
+    Hash = Super_CacheHashInt( Hash, nGatesMax );
+    Hash = Super_CacheHashDouble( Hash, tDelayMax );
+    Hash = Super_CacheHashDouble( Hash, tAreaMax );
+    Hash = Super_CacheHashInt( Hash, TimeLimit );
+    Hash = Super_CacheHashInt( Hash, fSkipInv );
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the cache file.]
+
+  Description [The directory is given by the "supercache" flag of the
+  frame (set supercache <dir>).  Returns NULL if caching is disabled.
+  The name is returned in a static buffer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Super_CacheFileName( Mio_Library_t * pLibGen, word Hash )
+{
+    static char FileName[1000];
+    char * pDir = Abc_FrameReadFlag( (char *)"supercache" );
+    char * pBase;
+    if ( pDir == NULL || pDir[0] == 0 )
+        return NULL;
+    pBase = Extra_FileNameWithoutPath( Mio_LibraryReadName(pLibGen) );
+    snprintf( FileName, sizeof(FileName), "%s/%s.%016llx.scache", pDir, pBase, (unsigned long long)Hash );
+    return FileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the supergate text from the cache.]
+
+  Description [Returns NULL if the file does not exist or does not match
+  the key.  The resulting string should be released by Super_CacheFree().
+  When mmap() is available, the string points into the mapped file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Super_CacheLoad( char * pFileName, word Hash )
+{
+    Super_CacheHead_t Head;
+    Vec_Str_t * vStr;
+#ifndef _WIN32
+    struct stat Stat;
+    char * pMap;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) < 0 || Stat.st_size < (off_t)sizeof(Super_CacheHead_t) )
+    {
+        close( fd );
+        return NULL;
+    }
+    pMap = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pMap == (char *)MAP_FAILED )
+        return NULL;
+    memcpy( &Head, pMap, sizeof(Super_CacheHead_t) );
+    if ( memcmp( Head.Magic, SUPER_CACHE_MAGIC, sizeof(SUPER_CACHE_MAGIC) ) || Head.Version != SUPER_CACHE_VERSION ||
+         Head.Hash != Hash || Head.nSize + sizeof(Super_CacheHead_t) != (word)Stat.st_size || Head.nSize > 0x7FFFFFFF )
+    {
+        munmap( pMap, (size_t)Stat.st_size );
+        return NULL;
+    }
+    // the capacity of zero marks the string as a view of the mapped file
+    vStr = ABC_CALLOC( Vec_Str_t, 1 );
+    vStr->nSize  = (int)Head.nSize;
+    vStr->nCap   = 0;
+    vStr->pArray = pMap + sizeof(Super_CacheHead_t);
+    return vStr;
+#else
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    if ( fread( &Head, sizeof(Super_CacheHead_t), 1, pFile ) != 1 || memcmp( Head.Magic, SUPER_CACHE_MAGIC, sizeof(SUPER_CACHE_MAGIC) ) ||
+         Head.Version != SUPER_CACHE_VERSION || Head.Hash != Hash || Head.nSize > 0x7FFFFFFF )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    vStr = Vec_StrStart( (int)Head.nSize );
+    if ( fread( Vec_StrArray(vStr), 1, (size_t)Head.nSize, pFile ) != (size_t)Head.nSize )
+        Vec_StrFreeP( &vStr );
+    fclose( pFile );
+    return vStr;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the string returned by Super_CacheLoad().]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Super_CacheFree( Vec_Str_t * vStr )
+{
+#ifndef _WIN32
+    if ( vStr && vStr->nCap == 0 && vStr->pArray )
+    {
+        munmap( vStr->pArray - sizeof(Super_CacheHead_t), sizeof(Super_CacheHead_t) + (size_t)vStr->nSize );
+        ABC_FREE( vStr );
+        return;
+    }
+#endif
+    Vec_StrFreeP( &vStr );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the supergate text into the cache.]
+
+  Description [The file is written under a temporary name and renamed,
+  so that concurrent ABC processes never see a partial file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Super_CacheSave( char * pFileName, word Hash, Vec_Str_t * vStr )
+{
+    Super_CacheHead_t Head;
+    char * pTemp = ABC_ALLOC( char, strlen(pFileName) + 32 );
+    FILE * pFile;
+    int RetValue;
+    sprintf( pTemp, "%s.tmp%d_%d", pFileName, (int)getpid(), (int)Abc_Clock() & 0xFFFF );
+    pFile = fopen( pTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pTemp );
+        return 0;
+    }
+    memset( &Head, 0, sizeof(Super_CacheHead_t) );
+    memcpy( Head.Magic, SUPER_CACHE_MAGIC, sizeof(SUPER_CACHE_MAGIC) );
+    Head.Version = SUPER_CACHE_VERSION;
+    Head.Hash    = Hash;
+    Head.nSize   = (word)Vec_StrSize(vStr);
+    RetValue  = fwrite( &Head, sizeof(Super_CacheHead_t), 1, pFile ) == 1;
+    RetValue &= fwrite( Vec_StrArray(vStr), 1, (size_t)Vec_StrSize(vStr), pFile ) == (size_t)Vec_StrSize(vStr);
+    RetValue &= fclose( pFile ) == 0;
+    if ( RetValue )
+        RetValue = rename( pTemp, pFileName ) == 0;
+    if ( !RetValue )
+        remove( pTemp );
+    ABC_FREE( pTemp );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Precomputes the library of supergates using the cache.]
+
+  Description [Same as Super_PrecomputeStr() but first looks up the result
+  in the cache and saves it there after computing.  The resulting string
+  should be released by Super_CacheFree().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Super_PrecomputeStrCached( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose )
+{
+    Vec_Str_t * vStr;
+    word Hash = Super_CacheHash( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv );
+    char * pFileName = Super_CacheFileName( pLibGen, Hash );
+    abctime clk = Abc_Clock();
+    if ( pFileName == NULL )
+        return Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, fVerbose );
+    pFileName = Abc_UtilStrsav( pFileName );
+    vStr = Super_CacheLoad( pFileName, Hash );
+    if ( vStr != NULL )
+    {
+        if ( fVerbose )
+        {
+            printf( "Loaded supergates from cache \"%s\" (%.3f MB).  ", pFileName, 1.0*Vec_StrSize(vStr)/(1<<20) );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        ABC_FREE( pFileName );
+        return vStr;
+    }
+    vStr = Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, fVerbose );
+    if ( vStr != NULL && !Super_CacheSave( pFileName, Hash, vStr ) && fVerbose )
+        printf( "Cannot write supergate cache \"%s\".\n", pFileName );
+    ABC_FREE( pFileName );
+    return vStr;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
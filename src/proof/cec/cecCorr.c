@@ -20,6 +20,17 @@
 
 #include "cecInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -910,6 +921,162 @@ int Cec_ManLSCorrAnalyzeDependence( Gia_Man_t * p, Vec_Int_t * vEquivs, Vec_Str_
     return 0;
 }
 
+#ifndef ABC_USE_PTHREADS
+
+Vec_Int_t * Cec_ManLSCorrSolvePar( Gia_Man_t * pSrm, Cec_ParCor_t * pPars, Vec_Str_t ** pvStatus )
+{
+    return Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, pvStatus, 0, 0 );
+}
+
+#else // pthreads are used
+
+#define CEC_COR_THR_MAX 100
+
+typedef struct Cec_CorShare_t_ Cec_CorShare_t;
+struct Cec_CorShare_t_
+{
+    int              nBTLimit;       // conflict limit
+    int              nChunkSize;     // the number of outputs in one chunk
+    int              nOuts;          // the number of outputs
+    Vec_Ptr_t *      vCexes;         // the counter-examples of the chunks
+    Vec_Ptr_t *      vStats;         // the statuses of the chunks
+    int              iNext;          // the next chunk to solve
+    pthread_mutex_t  Mutex;          // protects the next chunk
+};
+
+typedef struct Cec_CorThData_t_ Cec_CorThData_t;
+struct Cec_CorThData_t_
+{
+    Cec_CorShare_t * pShare;         // shared data
+    Gia_Man_t *      pSrm;           // copy of the SRM
+};
+
+void * Cec_ManLSCorrWorkerThread( void * pArg )
+{
+    extern void Cec_ManSatAddToStore( Vec_Int_t * vCexStore, Vec_Int_t * vCex, int Out );
+    Cec_CorThData_t * pThData = (Cec_CorThData_t *)pArg;
+    Cec_CorShare_t * p = pThData->pShare;
+    Gia_Man_t * pSrm = pThData->pSrm;
+    Vec_Int_t * vCexStore, * vCex;
+    Vec_Str_t * vStatus;
+    Gia_Obj_t * pRoot;
+    Cbs_Man_t * pCbs;
+    int i, iChunk, status;
+    // prepare the SRM as in Cbs_ManSolveMiterNc()
+    Gia_ManCreateRefs( pSrm );
+    Gia_ManCleanMark0( pSrm );
+    Gia_ManCleanMark1( pSrm );
+    Gia_ManFillValue( pSrm );
+    Gia_ManSetPhase( pSrm );
+    pCbs = Cbs_ManAlloc( pSrm );
+    Cbs_ManSetConflictNum( pCbs, p->nBTLimit );
+    vCex = Cbs_ReadModel( pCbs );
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        iChunk = p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iChunk >= Vec_PtrSize(p->vStats) )
+            break;
+        vStatus   = Vec_StrAlloc( p->nChunkSize );
+        vCexStore = Vec_IntAlloc( 1000 );
+        for ( i = iChunk * p->nChunkSize; i < Abc_MinInt((iChunk + 1) * p->nChunkSize, p->nOuts); i++ )
+        {
+            pRoot = Gia_ManCo( pSrm, i );
+            Vec_IntClear( vCex );
+            if ( Gia_ObjIsConst0(Gia_ObjFanin0(pRoot)) )
+            {
+                if ( Gia_ObjFaninC0(pRoot) )
+                    Cec_ManSatAddToStore( vCexStore, vCex, i ); // trivial counter-example
+                Vec_StrPush( vStatus, (char)!Gia_ObjFaninC0(pRoot) );
+                continue;
+            }
+            status = Cbs_ManSolve( pCbs, Gia_ObjChild0(pRoot) );
+            Vec_StrPush( vStatus, (char)status );
+            if ( status == -1 )
+                Cec_ManSatAddToStore( vCexStore, NULL, i ); // timeout
+            else if ( status == 0 )
+                Cec_ManSatAddToStore( vCexStore, vCex, i );
+        }
+        Vec_PtrWriteEntry( p->vCexes, iChunk, vCexStore );
+        Vec_PtrWriteEntry( p->vStats, iChunk, vStatus );
+    }
+    Cbs_ManStop( pCbs );
+    pthread_exit( NULL );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the SRM using several threads.]
+
+  Description [The outputs are divided into chunks of consecutive outputs,
+  which are taken by the threads from a shared counter. Each thread solves
+  its chunks with its own circuit-based solver on its own copy of the SRM.
+  The copy has the same object numbering and fanout counts, and the solver
+  keeps no state between the outputs, so each output gets the same status
+  and counter-example as in Cbs_ManSolveMiterNc(). The results are merged 
+  in the order of outputs, so the classes are refined exactly as in the
+  serial run and the same fixed point is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec_ManLSCorrSolvePar( Gia_Man_t * pSrm, Cec_ParCor_t * pPars, Vec_Str_t ** pvStatus )
+{
+    Cec_CorShare_t Share, * p = &Share;
+    Cec_CorThData_t ThData[CEC_COR_THR_MAX];
+    pthread_t WorkerThread[CEC_COR_THR_MAX];
+    Vec_Int_t * vCexStore, * vCexPart;
+    Vec_Str_t * vStatus, * vStatPart;
+    int nProcs = Abc_MinInt( pPars->nProcs, CEC_COR_THR_MAX );
+    int i, nChunks, status;
+    p->nBTLimit   = pPars->nBTLimit;
+    p->nOuts      = Gia_ManCoNum( pSrm );
+    p->nChunkSize = Abc_MaxInt( 1, (p->nOuts + 4 * nProcs - 1) / (4 * nProcs) );
+    nChunks       = (p->nOuts + p->nChunkSize - 1) / p->nChunkSize;
+    if ( nChunks == 1 )
+        return Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, pvStatus, 0, 0 );
+    p->vCexes     = Vec_PtrStart( nChunks );
+    p->vStats     = Vec_PtrStart( nChunks );
+    p->iNext      = 0;
+    nProcs = Abc_MinInt( nProcs, nChunks );
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pShare = p;
+        ThData[i].pSrm   = Gia_ManDup( pSrm );
+        status = pthread_create( WorkerThread + i, NULL, Cec_ManLSCorrWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        Gia_ManStop( ThData[i].pSrm );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    // merge the results in the order of outputs
+    vStatus   = Vec_StrAlloc( p->nOuts );
+    vCexStore = Vec_IntAlloc( 10000 );
+    for ( i = 0; i < nChunks; i++ )
+    {
+        vStatPart = (Vec_Str_t *)Vec_PtrEntry( p->vStats, i );
+        vCexPart  = (Vec_Int_t *)Vec_PtrEntry( p->vCexes, i );
+        Vec_StrPushBuffer( vStatus, Vec_StrArray(vStatPart), Vec_StrSize(vStatPart) );
+        Vec_IntAppend( vCexStore, vCexPart );
+        Vec_StrFree( vStatPart );
+        Vec_IntFree( vCexPart );
+    }
+    assert( Vec_StrSize(vStatus) == p->nOuts );
+    Vec_PtrFree( p->vCexes );
+    Vec_PtrFree( p->vStats );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Internal procedure for register correspondence.]
@@ -1010,7 +1177,9 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
 //Gia_DumpAiger( pSrm, "corrsrm", r, 2 );
         // found counter-examples to speculation
         clk2 = Abc_Clock();
-        if ( pPars->fUseCSat )
+        if ( pPars->nProcs > 1 && pPars->fUseCSat )
+            vCexStore = Cec_ManLSCorrSolvePar( pSrm, pPars, &vStatus );
+        else if ( pPars->fUseCSat )
             vCexStore = Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0, 0 );
         else
             vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
@@ -22,6 +22,17 @@
 #include "misc/util/utilTruth.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -81,6 +92,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// asynchronous SAT calls
+typedef struct Cec4_Async_t_ Cec4_Async_t;
+
 // SAT solving manager
 typedef struct Cec4_Man_t_ Cec4_Man_t;
 struct Cec4_Man_t_
@@ -102,6 +116,7 @@ struct Cec4_Man_t_
     Vec_Bit_t *      vFails;
     Vec_Bit_t *      vCoDrivers;
     Vec_Int_t *      vPairs;   
+    Cec4_Async_t *   pAsync;         // asynchronous SAT calls
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
@@ -219,6 +234,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nProcs         =       1;    // the number of threads for SAT calls
     pPars->fBMiterInfo    =       0;    // printing BMiter information
 }
 
@@ -1484,6 +1500,288 @@ int Cec4_ManGeneratePatterns( Cec4_Man_t * p )
     return CountPat >= i / p->pPars->nItersMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Asynchronous SAT calls.]
+
+  Description [Worker threads with their own incremental solvers check
+  candidate pairs ahead of the main sweeping loop, using a small conflict
+  limit. Each thread builds CNF for the cones of the user's AIG, whose
+  structure does not change during sweeping. The main thread dispatches
+  batches of pairs to idle threads and collects the results: proved pairs
+  are merged without calling the main solver, while counter-examples are
+  added to the simulation patterns, which later refine the classes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+Cec4_Async_t * Cec4_AsyncStart( Gia_Man_t * p, Cec_ParFra_t * pPars ) { printf( "Multi-threaded SAT calls are not available without pthreads.\n" ); return NULL; }
+void           Cec4_AsyncStop( Cec4_Async_t * p, int fVerbose )       {}
+int            Cec4_AsyncUpdate( Cec4_Async_t * p, int iObj )          { return 0; }
+int            Cec4_AsyncProvedRepr( Cec4_Async_t * p, int iObj )      { return -1; }
+void           Cec4_AsyncRewind( Cec4_Async_t * p, int iObj )          {}
+Vec_Int_t *    Cec4_AsyncPatterns( Cec4_Async_t * p )                  { return NULL; }
+
+#else // pthreads are used
+
+#define CEC4_THR_MAX 100
+
+typedef struct Cec4_ThData_t_ Cec4_ThData_t;
+struct Cec4_ThData_t_
+{
+    Gia_Man_t *      p;              // user's AIG (only the structure is used)
+    sat_solver *     pSat;           // SAT solver of this thread
+    Vec_Int_t *      vObj2Var;       // SAT variable of each object (-1 if none)
+    Vec_Int_t *      vUsed;          // objects having SAT variables
+    Vec_Int_t *      vCis;           // pairs (CiAigId, SatId)
+    Vec_Int_t *      vJobs;          // pairs (iRepr, iObj) to be solved
+    Vec_Int_t *      vRes;           // results (iObj, iRepr, status, nLits, lits)
+    int              nBTLimit;       // conflict limit of one call
+    int              nSatVarMax;     // the max number of SAT variables
+    int              nCallsRecycle;  // calls to perform before recycling
+    int              nCallsSince;    // calls since the last recycling
+    int              fWorking;       // the thread is busy
+};
+struct Cec4_Async_t_
+{
+    Gia_Man_t *      pAig;           // user's AIG
+    int              nProcs;         // the number of threads
+    int              nBatch;         // the number of pairs in one batch
+    int              nLevelMax;      // the max level of nodes to consider
+    int              iNext;          // the next node to dispatch
+    Vec_Int_t *      vProved;        // representative of each node proved by a thread
+    Vec_Int_t *      vPats;          // counter-examples (CI literals followed by -1)
+    Cec4_ThData_t    ThData[CEC4_THR_MAX];
+    pthread_t        WorkerThread[CEC4_THR_MAX];
+    // statistics
+    int              nJobs;
+    int              nProved;
+    int              nDisproved;
+    int              nUndec;
+};
+
+static void Cec4_AsyncRecycle( Cec4_ThData_t * p )
+{
+    int i, iObj;
+    sat_solver_reset( p->pSat );
+    Vec_IntForEachEntry( p->vUsed, iObj, i )
+        Vec_IntWriteEntry( p->vObj2Var, iObj, -1 );
+    Vec_IntClear( p->vUsed );
+    Vec_IntClear( p->vCis );
+    p->nCallsSince = 0;
+}
+static int Cec4_AsyncObjVar_rec( Cec4_ThData_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->p, iObj );
+    int iVar, iVar0 = -1, iVar1 = -1, Lit;
+    if ( (iVar = Vec_IntEntry(p->vObj2Var, iObj)) >= 0 )
+        return iVar;
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        iVar0 = Cec4_AsyncObjVar_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+        iVar1 = Cec4_AsyncObjVar_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+    }
+    iVar = sat_solver_addvar( p->pSat );
+    Vec_IntWriteEntry( p->vObj2Var, iObj, iVar );
+    Vec_IntPush( p->vUsed, iObj );
+    if ( Gia_ObjIsCi(pObj) )
+        Vec_IntPushTwo( p->vCis, iObj, iVar );
+    else if ( Gia_ObjIsConst0(pObj) )
+    {
+        Lit = Abc_Var2Lit( iVar, 1 );
+        sat_solver_addclause( p->pSat, &Lit, 1 );
+    }
+    else if ( Gia_ObjIsXor(pObj) )
+        sat_solver_add_xor( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) );
+    else 
+        sat_solver_add_and( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
+    return iVar;
+}
+static int Cec4_AsyncSolvePair( Cec4_ThData_t * p, int iRepr, int iObj )
+{
+    int fCompl = Gia_ManObj(p->p, iObj)->fPhase ^ Gia_ManObj(p->p, iRepr)->fPhase;
+    int iVar0, iVar1, Lits[2], status;
+    if ( ++p->nCallsSince > p->nCallsRecycle && Vec_IntSize(p->vUsed) > p->nSatVarMax )
+        Cec4_AsyncRecycle( p );
+    iVar1 = Cec4_AsyncObjVar_rec( p, iObj );
+    sat_solver_set_conflict_budget( p->pSat, p->nBTLimit );
+    if ( iRepr == 0 )
+    {
+        Lits[0] = Abc_Var2Lit( iVar1, fCompl );
+        return sat_solver_solve( p->pSat, Lits, 1 );
+    }
+    iVar0 = Cec4_AsyncObjVar_rec( p, iRepr );
+    Lits[0] = Abc_Var2Lit( iVar0, 1 );
+    Lits[1] = Abc_Var2Lit( iVar1, fCompl );
+    status = sat_solver_solve( p->pSat, Lits, 2 );
+    if ( status != GLUCOSE_UNSAT )
+        return status;
+    Lits[0] = Abc_Var2Lit( iVar0, 0 );
+    Lits[1] = Abc_Var2Lit( iVar1, !fCompl );
+    sat_solver_set_conflict_budget( p->pSat, p->nBTLimit );
+    return sat_solver_solve( p->pSat, Lits, 2 );
+}
+void * Cec4_AsyncWorkerThread( void * pArg )
+{
+    Cec4_ThData_t * pThData = (Cec4_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    int i, k, iRepr, iObj, IdAig, IdSat, status;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->p == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Vec_IntForEachEntryDouble( pThData->vJobs, iRepr, iObj, i )
+        {
+            status = Cec4_AsyncSolvePair( pThData, iRepr, iObj );
+            Vec_IntPushThree( pThData->vRes, iObj, iRepr, status );
+            if ( status != GLUCOSE_SAT )
+                continue;
+            Vec_IntPush( pThData->vRes, Vec_IntSize(pThData->vCis)/2 );
+            Vec_IntForEachEntryDouble( pThData->vCis, IdAig, IdSat, k )
+                Vec_IntPush( pThData->vRes, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(pThData->pSat, IdSat)) );
+        }
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+Cec4_Async_t * Cec4_AsyncStart( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
+{
+    Cec4_Async_t * p = ABC_CALLOC( Cec4_Async_t, 1 );
+    int i, status;
+    p->pAig      = pAig;
+    p->nProcs    = Abc_MinInt( pPars->nProcs, CEC4_THR_MAX );
+    p->nBatch    = 32;
+    p->nLevelMax = pPars->nLevelMax;
+    p->vProved   = Vec_IntStartFull( Gia_ManObjNum(pAig) );
+    p->vPats     = Vec_IntAlloc( 1000 );
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        Cec4_ThData_t * pTh = p->ThData + i;
+        pTh->p             = pAig;
+        pTh->pSat          = sat_solver_start();
+        pTh->vObj2Var      = Vec_IntStartFull( Gia_ManObjNum(pAig) );
+        pTh->vUsed         = Vec_IntAlloc( 1000 );
+        pTh->vCis          = Vec_IntAlloc( 1000 );
+        pTh->vJobs         = Vec_IntAlloc( 2 * p->nBatch );
+        pTh->vRes          = Vec_IntAlloc( 1000 );
+        // the threads only take easy calls, the rest is left to the main solver
+        pTh->nBTLimit      = Abc_MaxInt( 1, Abc_MinInt(pPars->nBTLimit, 1000) );
+        pTh->nSatVarMax    = pPars->nSatVarMax ? pPars->nSatVarMax : ABC_INFINITY;
+        pTh->nCallsRecycle = pPars->nCallsRecycle;
+        pTh->fWorking      = 0;
+        status = pthread_create( p->WorkerThread + i, NULL, Cec4_AsyncWorkerThread, (void *)pTh );  assert( status == 0 );
+    }
+    return p;
+}
+void Cec4_AsyncStop( Cec4_Async_t * p, int fVerbose )
+{
+    int i;
+    // wait till threads finish
+    for ( i = 0; i < p->nProcs; i++ )
+        if ( p->ThData[i].fWorking )
+            i = -1;
+    // stop threads
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        p->ThData[i].p = NULL;
+        p->ThData[i].fWorking = 1;
+    }
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        Cec4_ThData_t * pTh = p->ThData + i;
+        pthread_join( p->WorkerThread[i], NULL );
+        sat_solver_stop( pTh->pSat );
+        Vec_IntFree( pTh->vObj2Var );
+        Vec_IntFree( pTh->vUsed );
+        Vec_IntFree( pTh->vCis );
+        Vec_IntFree( pTh->vJobs );
+        Vec_IntFree( pTh->vRes );
+    }
+    if ( fVerbose )
+        printf( "Threads = %d.  Async SAT calls = %d:  P = %d  D = %d  F = %d\n", 
+            p->nProcs, p->nJobs, p->nProved, p->nDisproved, p->nUndec );
+    Vec_IntFree( p->vProved );
+    Vec_IntFree( p->vPats );
+    ABC_FREE( p );
+}
+int Cec4_AsyncUpdate( Cec4_Async_t * p, int iObj )
+{
+    Gia_Man_t * pAig = p->pAig;
+    int i, k, nLits, iCand, * pRes, * pLimit;
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        Cec4_ThData_t * pTh = p->ThData + i;
+        if ( pTh->fWorking )
+            continue;
+        // collect the results
+        pRes   = Vec_IntArray( pTh->vRes );
+        pLimit = Vec_IntLimit( pTh->vRes );
+        while ( pRes < pLimit )
+        {
+            if ( pRes[2] == GLUCOSE_UNSAT )
+                Vec_IntWriteEntry( p->vProved, pRes[0], pRes[1] ), p->nProved++;
+            else if ( pRes[2] == GLUCOSE_UNDEC )
+                p->nUndec++;
+            else
+            {
+                nLits = pRes[3];
+                for ( k = 0; k < nLits; k++ )
+                    Vec_IntPush( p->vPats, pRes[4+k] );
+                Vec_IntPush( p->vPats, -1 );
+                pRes += 1 + nLits;
+                p->nDisproved++;
+            }
+            pRes += 3;
+        }
+        assert( pRes == pLimit );
+        Vec_IntClear( pTh->vRes );
+        Vec_IntClear( pTh->vJobs );
+        // dispatch the next batch of candidates following the current node
+        p->iNext = Abc_MaxInt( p->iNext, iObj + 1 );
+        for ( ; p->iNext < Gia_ManObjNum(pAig) && Vec_IntSize(pTh->vJobs) < 2 * p->nBatch; p->iNext++ )
+        {
+            iCand = p->iNext;
+            if ( !Gia_ObjIsAnd(Gia_ManObj(pAig, iCand)) || Gia_ObjRepr(pAig, iCand) == GIA_VOID )
+                continue;
+            if ( Gia_ObjProved(pAig, iCand) || Gia_ObjFailed(pAig, iCand) )
+                continue;
+            if ( p->nLevelMax && Gia_ObjLevelId(pAig, iCand) > p->nLevelMax )
+                continue;
+            Vec_IntPushTwo( pTh->vJobs, Gia_ObjRepr(pAig, iCand), iCand );
+        }
+        if ( Vec_IntSize(pTh->vJobs) == 0 )
+            continue;
+        p->nJobs += Vec_IntSize(pTh->vJobs) / 2;
+        pTh->fWorking = 1;
+    }
+    return Vec_IntSize(p->vPats);
+}
+int Cec4_AsyncProvedRepr( Cec4_Async_t * p, int iObj )
+{
+    return Vec_IntEntry( p->vProved, iObj );
+}
+void Cec4_AsyncRewind( Cec4_Async_t * p, int iObj )
+{
+    // the main loop went back after refinement: the candidates are dispatched again
+    p->iNext = Abc_MinInt( p->iNext, iObj );
+}
+Vec_Int_t * Cec4_AsyncPatterns( Cec4_Async_t * p )
+{
+    return p->vPats;
+}
+
+#endif // pthreads are used
 
 /**Function*************************************************************
 
@@ -1609,6 +1907,55 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     //    printf( "*  " );
     return status;
 }
+void Cec4_ManSavePattern( Cec4_Man_t * p )
+{
+    int i, iLit;
+    assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
+    p->pAig->iPatsPi++;
+    Vec_IntForEachEntry( p->vPat, iLit, i )
+        Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
+    if ( p->pAig->vPats )
+    {
+        Vec_IntPush( p->pAig->vPats, Vec_IntSize(p->vPat)+2 );
+        Vec_IntAppend( p->pAig->vPats, p->vPat );
+        Vec_IntPush( p->pAig->vPats, -1 );
+    }
+    // resimulated once in a while
+    if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
+    {
+        abctime clk2 = Abc_Clock();
+        Cec4_ManSimulate( p->pAig, p );
+        //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
+        p->nFaster[0] = p->nFaster[1] = 0;
+        //if ( p->nSatSat && p->nSatSat % 100 == 0 )
+            Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
+        Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
+        p->pAig->iPatsPi = 0;
+        Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
+        p->timeResimGlo += Abc_Clock() - clk2;
+    }
+}
+void Cec4_ManAsyncUpdate( Cec4_Man_t * p, int iObj )
+{
+    Vec_Int_t * vPats; int i, iLit;
+    if ( !Cec4_AsyncUpdate( p->pAsync, iObj ) )
+        return;
+    // add the counter-examples produced by the threads in one batch
+    vPats = Cec4_AsyncPatterns( p->pAsync );
+    Vec_IntClear( p->vPat );
+    Vec_IntForEachEntry( vPats, iLit, i )
+    {
+        if ( iLit >= 0 )
+        {
+            Vec_IntPush( p->vPat, iLit );
+            continue;
+        }
+        p->nPatterns++;
+        Cec4_ManSavePattern( p );
+        Vec_IntClear( p->vPat );
+    }
+    Vec_IntClear( vPats );
+}
 int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
@@ -1617,10 +1964,19 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, iObj) || Vec_BitEntry(p->vCoDrivers, iRepr) : 0;
+    if ( p->pAsync && Cec4_AsyncProvedRepr(p->pAsync, iObj) == iRepr )
+    {
+        // this pair was proved by one of the threads
+        p->nSatUnsat++;
+        pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
+        Gia_ObjSetProved( p->pAig, iObj );
+        if ( iRepr == 0 )
+            p->iLastConst = iObj;
+        return 1;
+    }
     status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
     if ( status == GLUCOSE_SAT )
     {
-        int iLit;
         //int iPatsOld = p->pAig->iPatsPi;
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
@@ -1638,16 +1994,6 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
             for ( i = 0; i < pCex[0]; )
                 Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
         }
-        assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
-        p->pAig->iPatsPi++;
-        Vec_IntForEachEntry( p->vPat, iLit, i )
-            Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
-        if ( p->pAig->vPats )
-        {
-            Vec_IntPush( p->pAig->vPats, Vec_IntSize(p->vPat)+2 );
-            Vec_IntAppend( p->pAig->vPats, p->vPat );
-            Vec_IntPush( p->pAig->vPats, -1 );
-        }
         //Cec4_ManPackAddPattern( p->pAig, p->vPat, 0 );
         //assert( iPatsOld + 1 == p->pAig->iPatsPi );
         if ( fEasy )
@@ -1657,20 +2003,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         RetValue = 0;
         // this is not needed, but we keep it here anyway, because it takes very little time
         //Cec4_ManVerify( p->pNew, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, p->pSat );
-        // resimulated once in a while
-        if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
-        {
-            abctime clk2 = Abc_Clock();
-            Cec4_ManSimulate( p->pAig, p );
-            //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
-            p->nFaster[0] = p->nFaster[1] = 0;
-            //if ( p->nSatSat && p->nSatSat % 100 == 0 )
-                Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
-            Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
-            p->pAig->iPatsPi = 0;
-            Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
-            p->timeResimGlo += Abc_Clock() - clk2;
-        }
+        Cec4_ManSavePattern( p );
     }
     else if ( status == GLUCOSE_UNSAT )
     {
@@ -1896,9 +2229,13 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
     pMan->pNew = Cec4_ManStartNew( p );
+    if ( pPars->nProcs > 1 )
+        pMan->pAsync = Cec4_AsyncStart( p, pPars );
     Gia_ManForEachAnd( p, pObj, i )
     {
         Gia_Obj_t * pObjNew; 
+        if ( pMan->pAsync )
+            Cec4_ManAsyncUpdate( pMan, i );
         pMan->nAndNodes++;
         if ( Gia_ObjIsXor(pObj) )
             pObj->Value = Gia_ManHashXorReal( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
@@ -1953,6 +2290,11 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         }
     }
     
+    if ( pMan->pAsync )
+    {
+        Cec4_AsyncStop( pMan->pAsync, pPars->fVerbose );
+        pMan->pAsync = NULL;
+    }
     if ( pPars->fBMiterInfo )
     {
         // print
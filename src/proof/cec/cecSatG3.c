@@ -83,6 +83,15 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// asynchronous SAT calls (cecSatG2.c)
+typedef struct Cec4_Async_t_ Cec4_Async_t;
+extern Cec4_Async_t * Cec4_AsyncStart( Gia_Man_t * p, Cec_ParFra_t * pPars );
+extern void           Cec4_AsyncStop( Cec4_Async_t * p, int fVerbose );
+extern int            Cec4_AsyncUpdate( Cec4_Async_t * p, int iObj );
+extern int            Cec4_AsyncProvedRepr( Cec4_Async_t * p, int iObj );
+extern void           Cec4_AsyncRewind( Cec4_Async_t * p, int iObj );
+extern Vec_Int_t *    Cec4_AsyncPatterns( Cec4_Async_t * p );
+
 // SAT solving manager
 typedef struct Cec5_Man_t_ Cec5_Man_t;
 struct Cec5_Man_t_
@@ -103,6 +112,7 @@ struct Cec5_Man_t_
     Vec_Int_t *      vDisprPairs;
     Vec_Bit_t *      vFails;
     Vec_Bit_t *      vCoDrivers;
+    Cec4_Async_t *   pAsync;         // asynchronous SAT calls
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
@@ -1720,6 +1730,28 @@ void Cec5_ManCheckGlobalSim( Cec5_Man_t * p){
         p->timeResimGlo += Abc_Clock() - clk2;
     }
 }
+void Cec5_ManAsyncUpdate( Cec5_Man_t * p, int iObj )
+{
+    Vec_Int_t * vPats; int i, iLit;
+    if ( !Cec4_AsyncUpdate( p->pAsync, iObj ) )
+        return;
+    // add the counter-examples produced by the threads in one batch
+    vPats = Cec4_AsyncPatterns( p->pAsync );
+    Vec_IntForEachEntry( vPats, iLit, i )
+    {
+        Vec_IntPush( p->vPiPatsCache, iLit );
+        if ( iLit >= 0 )
+            continue;
+        assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
+        p->pAig->iPatsPi++;
+        p->nPatterns++;
+        p->simTravId = p->pAig->iPatsPi / p->LocalBatchSize;
+        if( (p->pAig->iPatsPi % p->LocalBatchSize) == 0 || 1 == p->LocalBatchSize )
+            Cec5_FlushCache2Pattern(p);
+        Cec5_ManCheckGlobalSim(p);
+    }
+    Vec_IntClear( vPats );
+}
 int Cec5_ManSweepNode( Cec5_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
@@ -1966,6 +1998,8 @@ int Cec5_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
     pMan->pNew = Cec5_ManStartNew( p );
+    if ( pPars->nProcs > 1 )
+        pMan->pAsync = Cec4_AsyncStart( p, pPars );
 
     if( fCbs ){
         //Gia_ManCreateRefs( pMan->pNew );
@@ -1997,6 +2031,8 @@ resume:
         Gia_Obj_t * pObjNew; 
         if ( !Gia_ObjIsAnd(pObj) )
             continue;
+        if ( pMan->pAsync )
+            Cec5_ManAsyncUpdate( pMan, i );
         
         Vec_BitWriteEntry( pMan->vCexSite, i
             , Vec_BitEntry( pMan->vCexSite, Gia_ObjFaninId0(pObj,i) ) 
@@ -2051,6 +2087,18 @@ resume:
             continue;
         }
 
+        if ( pMan->pAsync && Cec4_AsyncProvedRepr(pMan->pAsync, i) == Gia_ObjId(p, pRepr) )
+        {
+            // this pair was proved by one of the threads
+            pMan->nSatUnsat++;
+            vMerged[i] = Gia_ObjId(p, pRepr);
+            Gia_ObjSetProved( p, i );
+            if ( Gia_ObjId(p, pRepr) == 0 )
+                pMan->iLastConst = i;
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            continue;
+        }
+
         if ( fCbs && (status = Cec5_ManSweepNodeCbs(pMan, pCbs, i, Gia_ObjId(p, pRepr), 0)) && Gia_ObjProved(p, i) ){
             vMerged[i] = Gia_ObjId(p, pRepr);
             pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
@@ -2071,6 +2119,8 @@ resume:
             //printf("go back to %6d from %6d\n", go_back, i );
             pMan->nAndNodes -= i-go_back;
             i = go_back-1, go_back = -1;
+            if ( pMan->pAsync )
+                Cec4_AsyncRewind( pMan->pAsync, i + 1 );
         }
     }
     if ( p->iPatsPi > 0 )
@@ -2086,11 +2136,18 @@ resume:
         if( -1 < go_back ){
             i = go_back - 1;
             go_back = -1;
+            if ( pMan->pAsync )
+                Cec4_AsyncRewind( pMan->pAsync, i + 1 );
             goto resume;
         }
     }
 
     ABC_FREE(vMerged);
+    if ( pMan->pAsync )
+    {
+        Cec4_AsyncStop( pMan->pAsync, pPars->fVerbose );
+        pMan->pAsync = NULL;
+    }
 
     if ( pPars->fVerbose )
         Cec5_ManPrintStats( p, pPars, pMan, 0 );
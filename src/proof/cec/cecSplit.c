@@ -23,6 +23,7 @@
 #include "aig/gia/giaAig.h"
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
 #include "misc/util/utilTruth.h"
 //#include "bdd/cudd/cuddInt.h"
 
@@ -46,7 +47,7 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fFork, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -327,7 +328,7 @@ static inline sat_solver * Cec_GiaDeriveSolver( Gia_Man_t * p, Cnf_Dat_t * pCnf,
     sat_solver_set_runtime_limit( pSat, nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
     return pSat;
 }
-static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut, int * pnVars, int * pnConfs )
+static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut, int * pStop, int * pnVars, int * pnConfs )
 {
     int status;
     sat_solver * pSat = Cec_GiaDeriveSolver( p, pCnf, nTimeOut );
@@ -337,6 +338,7 @@ static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut
         *pnConfs = 0;
         return 1;
     }
+    pSat->pstop = pStop;
     status   = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
     *pnVars  = sat_solver_nvars( pSat );
     *pnConfs = sat_solver_nconflicts( pSat );
@@ -349,6 +351,72 @@ static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut
         return 1;
     return 0;
 }
+static inline satoko_t * Cec_GiaDeriveSatoko( Cnf_Dat_t * pCnf )
+{
+    satoko_t * pSat;
+    int i;
+    pSat = satoko_create();
+    satoko_setnvars( pSat, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !satoko_add_clause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
+        {
+            // the problem is UNSAT
+            satoko_destroy( pSat );
+            return NULL;
+        }
+    if ( satoko_simplify( pSat ) != SATOKO_OK )
+    {
+        satoko_destroy( pSat );
+        return NULL;
+    }
+    return pSat;
+}
+// solves the cube of pPart (its cofactoring variables) in a fork of the solver 
+// loaded with the CNF of the original miter pBase; the base solver is only read
+static inline int Cnf_GiaSolveOneFork( Gia_Man_t * pBase, Cnf_Dat_t * pCnf, satoko_t * pSatBase, Gia_Man_t * pPart, int nTimeOut, int * pStop, int * pnVars, int * pnConfs )
+{
+    satoko_t * pSat;
+    Gia_Obj_t * pObj;
+    int i, iLit, Lit, * pModel, status = SATOKO_UNSAT;
+    // the cofactor may be structurally constant, which the base CNF does not see
+    Gia_ManForEachPo( pPart, pObj, i )
+        if ( Gia_ObjFaninLit0p(pPart, pObj) != 0 )
+            break;
+    if ( i == Gia_ManPoNum(pPart) )
+    {
+        *pnVars  = 0;
+        *pnConfs = 0;
+        return 1;
+    }
+    pSat = satoko_fork( pSatBase );
+    satoko_set_stop( pSat, pStop );
+    satoko_set_runtime_limit( pSat, nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
+    if ( pPart->vCofVars )
+        Vec_IntForEachEntry( pPart->vCofVars, iLit, i )
+        {
+            Lit = Abc_Var2Lit( pCnf->pVarNums[Gia_ManCiIdToId(pBase, Abc_Lit2Var(iLit))], Abc_LitIsCompl(iLit) );
+            if ( !satoko_add_clause( pSat, &Lit, 1 ) )
+                break;
+        }
+    if ( pPart->vCofVars == NULL || i == Vec_IntSize(pPart->vCofVars) )
+        status = satoko_solve( pSat );
+    *pnVars  = satoko_varnum( pSat );
+    *pnConfs = satoko_conflictnum( pSat );
+    if ( status == SATOKO_SAT )
+    {
+        pModel = ABC_CALLOC( int, Gia_ManPiNum(pBase) );
+        Gia_ManForEachPi( pBase, pObj, i )
+            pModel[i] = satoko_read_cex_varvalue( pSat, pCnf->pVarNums[Gia_ObjId(pBase, pObj)] );
+        pPart->pCexComb = Abc_CexCreate( 0, Gia_ManPiNum(pBase), pModel, 0, 0, 0 );
+        ABC_FREE( pModel );
+    }
+    satoko_destroy( pSat );
+    if ( status == SATOKO_UNDEC )
+        return -1;
+    if ( status == SATOKO_UNSAT )
+        return 1;
+    return 0;
+}
 static inline void Cec_GiaSplitClean( Vec_Ptr_t * vStack )
 {
     Gia_Man_t * pNew;
@@ -357,6 +425,13 @@ static inline void Cec_GiaSplitClean( Vec_Ptr_t * vStack )
         Gia_ManStop( pNew );
     Vec_PtrFree( vStack );
 }
+static inline void Cec_GiaSplitCleanFork( Cnf_Dat_t * pCnf, satoko_t * pSat )
+{
+    if ( pCnf )
+        Cnf_DataFree( pCnf );
+    if ( pSat )
+        satoko_destroy( pSat );
+}
 
 /**Function*************************************************************
 
@@ -403,30 +478,42 @@ void Cec_GiaSplitPrintRefs( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fFork, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Vec_Ptr_t * vStack;
-    Cnf_Dat_t * pCnf;
-    int nSatVars, nSatConfs;
+    Cnf_Dat_t * pCnf, * pCnfBase = NULL;
+    satoko_t * pSatBase = NULL;
+    int nSatVars = 0, nSatConfs = 0;
     int nIter, status, RetValue = -1;
     double Progress = 0;
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
-    Cnf_DataFree( pCnf );
+    if ( fFork )
+    {
+        pCnfBase = pCnf;
+        pSatBase = Cec_GiaDeriveSatoko( pCnfBase );
+        status = pSatBase ? Cnf_GiaSolveOneFork( p, pCnfBase, pSatBase, p, nTimeOut, NULL, &nSatVars, &nSatConfs ) : 1;
+    }
+    else
+    {
+        status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, NULL, &nSatVars, &nSatConfs );
+        Cnf_DataFree( pCnf );
+    }
     if ( fVerbose )
         Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
     if ( status == 0 )
     {
         if ( !fSilent )
         printf( "The problem is SAT without cofactoring.\n" );
+        Cec_GiaSplitCleanFork( pCnfBase, pSatBase );
         return 0;
     }
     if ( status == 1 )
     {
         if ( !fSilent )
         printf( "The problem is UNSAT without cofactoring.\n" );
+        Cec_GiaSplitCleanFork( pCnfBase, pSatBase );
         return 1;
     }
     assert( status == -1 );
@@ -458,9 +545,14 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
         Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
         // solve the problem
-        pCnf = Cec_GiaDeriveGiaRemapped( pPart );
-        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs );
-        Cnf_DataFree( pCnf );
+        if ( pSatBase )
+            status = Cnf_GiaSolveOneFork( p, pCnfBase, pSatBase, pPart, nTimeOut, NULL, &nSatVars, &nSatConfs );
+        else
+        {
+            pCnf = Cec_GiaDeriveGiaRemapped( pPart );
+            status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, NULL, &nSatVars, &nSatConfs );
+            Cnf_DataFree( pCnf );
+        }
         if ( status == 1 )
             Progress += 1.0 / pow((double)2, (double)Depth);
         if ( fVerbose ) 
@@ -485,9 +577,14 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 0) );
         Gia_ManStop( pLast );
         // solve the problem
-        pCnf = Cec_GiaDeriveGiaRemapped( pPart );
-        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs );
-        Cnf_DataFree( pCnf );
+        if ( pSatBase )
+            status = Cnf_GiaSolveOneFork( p, pCnfBase, pSatBase, pPart, nTimeOut, NULL, &nSatVars, &nSatConfs );
+        else
+        {
+            pCnf = Cec_GiaDeriveGiaRemapped( pPart );
+            status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, NULL, &nSatVars, &nSatConfs );
+            Cnf_DataFree( pCnf );
+        }
         if ( status == 1 )
             Progress += 1.0 / pow((double)2, (double)Depth);
         if ( fVerbose )
@@ -506,10 +603,11 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         if ( nIterMax && nIter >= nIterMax )
             break;
     }
-    if ( Vec_PtrSize(vStack) == 0 )
+    if ( RetValue == -1 && Vec_PtrSize(vStack) == 0 )
         RetValue = 1;
     // finish
     Cec_GiaSplitClean( vStack );
+    Cec_GiaSplitCleanFork( pCnfBase, pSatBase );
     if ( !fSilent )
     {
         if ( RetValue == 0 )
@@ -542,9 +640,14 @@ typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
     Cnf_Dat_t * pCnf;
+    Gia_Man_t * pBase;      // the original miter (when cubes are solved by forking)
+    Cnf_Dat_t * pCnfBase;   // its CNF
+    satoko_t *  pSatBase;   // the solver loaded with this CNF
     int         iThread;
     int         nTimeOut;
     int         fWorking;
+    int         fStop;      // set by the manager to interrupt the solver
+    abctime     clkStart;   // when the current cube was started
     int         Result;
     int         nVars;
     int         nConfs;
@@ -563,63 +666,65 @@ void * Cec_GiaSplitWorkerThread( void * pArg )
             assert( 0 );
             return NULL;
         }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
+        if ( pThData->pSatBase )
+            pThData->Result = Cnf_GiaSolveOneFork( pThData->pBase, pThData->pCnfBase, pThData->pSatBase, pThData->p, pThData->nTimeOut, &pThData->fStop, &pThData->nVars, &pThData->nConfs );
+        else
+            pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->fStop, &pThData->nVars, &pThData->nConfs );
         pThData->fWorking = 0;
     }
     assert( 0 );
     return NULL;
 }
-int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fFork, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
     Vec_Ptr_t * vStack;
-    Cnf_Dat_t * pCnf;
+    Cnf_Dat_t * pCnfBase = NULL;
+    satoko_t * pSatBase = NULL;
     double Progress = 0;
-    int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    abctime clkSplit = (nTimeOut ? nTimeOut : 4) * CLOCKS_PER_SEC / 4;
+    int i, status, nIter = 0, nResplits = 0, RetValue = -1, fWorkToDo = 1;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
     if ( fVerbose )
-        printf( "Processes = %d   TimeOut = %d sec   MaxIter = %d   LookAhead = %d   Verbose = %d.\n", nProcs, nTimeOut, nIterMax, LookAhead, fVerbose );
+        printf( "Processes = %d   TimeOut = %d sec   MaxIter = %d   LookAhead = %d   Fork = %d   Verbose = %d.\n", nProcs, nTimeOut, nIterMax, LookAhead, fFork, fVerbose );
     fflush( stdout );
     if ( nProcs == 1 )
-        return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+        return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fFork, fVerbose, fVeryVerbose, fSilent );
     // subtract manager thread
     nProcs--;
     assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // check the problem
-    pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
-    Cnf_DataFree( pCnf );
-    if ( fVerbose && status != -1 )
-        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
-    if ( status == 0 )
-    {
-        if ( !fSilent )
-        printf( "The problem is SAT without cofactoring.\n" );
-        return 0;
-    }
-    if ( status == 1 )
-    {
-        if ( !fSilent )
-        printf( "The problem is UNSAT without cofactoring.\n" );
-        return 1;
-    }
-    assert( status == -1 );
-    // create local copy
+    // create local copy (the whole problem is the first cube; it is 
+    // split as soon as it runs long while other workers are idle)
     vStack = Vec_PtrAlloc( 1000 );
     Vec_PtrPush( vStack, Gia_ManDup(p) );
+    // load the miter into one solver, which is forked for each cube
+    if ( fFork )
+    {
+        pCnfBase = Cec_GiaDeriveGiaRemapped( p );
+        pSatBase = Cec_GiaDeriveSatoko( pCnfBase );
+        if ( pSatBase == NULL )
+        {
+            Vec_PtrClear( vStack );
+            fWorkToDo = 0;
+        }
+    }
     // start threads
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p        = NULL;
         ThData[i].pCnf     = NULL;
+        ThData[i].pBase    = p;
+        ThData[i].pCnfBase = pCnfBase;
+        ThData[i].pSatBase = pSatBase;
         ThData[i].iThread  = i;
         ThData[i].nTimeOut = nTimeOut;
         ThData[i].fWorking = 0;
+        ThData[i].fStop    = 0;
+        ThData[i].clkStart = 0;
         ThData[i].Result   = -1;
         ThData[i].nVars    = -1;
         ThData[i].nConfs   = -1;
@@ -674,7 +779,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
                     pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
                     pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
                     Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
+                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 0) );
                     Vec_PtrPush( vStack, pPart );
                     // keep working
                     fWorkToDo = 1;
@@ -693,16 +798,36 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
             // start a new thread
             assert( ThData[i].p == NULL );
             ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
+            ThData[i].pCnf = pSatBase ? NULL : Cec_GiaDeriveGiaRemapped( ThData[i].p );
+            ThData[i].fStop = 0;
+            ThData[i].clkStart = Abc_Clock();
             ThData[i].fWorking = 1;
         }
         if ( nIterMax && nIter >= nIterMax )
             break;
+        // when some workers are idle and no cubes are left, interrupt 
+        // the longest-running cube, which is then split into two cubes
+        if ( Vec_PtrSize(vStack) == 0 )
+        {
+            int nIdle = 0, iOldest = -1;
+            for ( i = 0; i < nProcs; i++ )
+                if ( !ThData[i].fWorking )
+                    nIdle++;
+                else if ( !ThData[i].fStop && (iOldest == -1 || ThData[i].clkStart < ThData[iOldest].clkStart) )
+                    iOldest = i;
+            if ( nIdle > 0 && iOldest >= 0 && Abc_Clock() - ThData[iOldest].clkStart > clkSplit )
+            {
+                ThData[iOldest].fStop = 1;
+                nResplits++;
+            }
+        }
     }
     if ( !fWorkToDo )
         RetValue = 1;
 finish:
-    // wait till threads finish
+    // interrupt the remaining cubes and wait till threads finish
+    for ( i = 0; i < nProcs; i++ )
+        ThData[i].fStop = 1;
     for ( i = 0; i < nProcs; i++ )
         if ( ThData[i].fWorking )
             i = -1;
@@ -722,6 +847,7 @@ finish:
     }
     // finish
     Cec_GiaSplitClean( vStack );
+    Cec_GiaSplitCleanFork( pCnfBase, pSatBase );
     if ( !fSilent )
     {
         if ( RetValue == 0 )
@@ -731,33 +857,37 @@ finish:
         else if ( RetValue == -1 )
             printf( "Problem is UNDECIDED " );
         else assert( 0 );
-        printf( "after %d case-splits.  ", nIter );
+        printf( "after %d case-splits (%d on the fly).  ", nIter, nResplits );
         Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
         fflush( stdout );
     }
     return RetValue;
 }
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fFork, int fVerbose, int fVeryVerbose, int fSilent )
 {
     Abc_Cex_t * pCex = NULL;
     Gia_Man_t * pOne;
     Gia_Obj_t * pObj;
-    int i, RetValue1, fOneUndef = 0, RetValue = -1;
+    int i, k, RetValue1, fOneUndef = 0, RetValue = -1;
     Abc_CexFreeP( &p->pCexComb );
     Gia_ManForEachPo( p, pObj, i )
     {
         pOne = Gia_ManDupOutputGroup( p, i, i+1 );
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
-        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
+        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead, fFork, fVerbose, fVeryVerbose, fSilent );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
-            pCex = pOne->pCexComb; pOne->pCexComb = NULL;
+            // the output cone has its PIs in the DFS order
+            pCex = Abc_CexAlloc( 0, Gia_ManPiNum(p), 1 );
             pCex->iPo = i;
+            Gia_ManForEachPi( p, pObj, k )
+                if ( ~pObj->Value && Abc_InfoHasBit(pOne->pCexComb->pData, Gia_ObjCioId(Gia_ManObj(pOne, Abc_Lit2Var(pObj->Value)))) )
+                    Abc_InfoSetBit( pCex->pData, k );
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
@@ -57,6 +57,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->fVerbose       =     0;  // verbose stats
     p->nNodesAhead    =  1000;  // the lookahead in terms of nodes
     p->nCallsRecycle  =   100;  // calls to perform before recycling SAT solver
+    p->nProcs         =     1;  // the number of concurrent SAT solvers
 }
 
 /**Function*************************************************************
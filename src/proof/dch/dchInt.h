@@ -59,6 +59,7 @@ struct Dch_Man_t_
     // equivalence classes
     Dch_Cla_t *      ppClasses;      // equivalence classes of nodes
     Aig_Obj_t **     pReprsProved;   // equivalences proved
+    Aig_Obj_t **     pReprsPar;      // equivalences proved by concurrent solvers
     // SAT solving
     sat_solver *     pSat;           // recyclable SAT solver
     int              nSatVars;       // the counter of SAT variables
@@ -146,9 +147,17 @@ extern void          Dch_CnfNodeAddToSolver( Dch_Man_t * p, Aig_Obj_t * pObj );
 extern Dch_Man_t *   Dch_ManCreate( Aig_Man_t * pAig, Dch_Pars_t * pPars );
 extern void          Dch_ManStop( Dch_Man_t * p );
 extern void          Dch_ManSatSolverRecycle( Dch_Man_t * p );
+/*=== dchPar.c ===================================================*/
+extern void          Dch_ManSweepPar( Dch_Man_t * p );
 /*=== dchSat.c ===================================================*/
 extern int           Dch_NodesAreEquiv( Dch_Man_t * p, Aig_Obj_t * pObj1, Aig_Obj_t * pObj2 );
 /*=== dchSim.c ===================================================*/
+extern unsigned      Dch_NodeHash( void * p, Aig_Obj_t * pObj );
+extern int           Dch_NodeIsConst( void * p, Aig_Obj_t * pObj );
+extern int           Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 );
+extern int           Dch_NodeIsConstCex( void * p, Aig_Obj_t * pObj );
+extern int           Dch_NodesAreEqualCex( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 );
+extern void          Dch_PerformSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims );
 extern Dch_Cla_t *   Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbose );
 /*=== dchSimSat.c ===================================================*/
 extern void          Dch_ManResimulateCex( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
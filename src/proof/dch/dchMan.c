@@ -135,6 +135,7 @@ void Dch_ManStop( Dch_Man_t * p )
     Vec_PtrFree( p->vSimRoots );
     Vec_PtrFree( p->vSimClasses );
     ABC_FREE( p->pReprsProved );
+    ABC_FREE( p->pReprsPar );
     ABC_FREE( p->pSatVars );
     ABC_FREE( p );
 }
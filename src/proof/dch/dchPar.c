@@ -0,0 +1,379 @@
+/**CFile****************************************************************
+
+  FileName    [dchPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Choice computation for tech-mapping.]
+
+  Synopsis    [Proving candidate equivalences with several SAT solvers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: dchPar.c,v 1.0 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "dchInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DCH_THR_MAX 64
+
+// the candidate pairs solved by one thread
+typedef struct Dch_ParThData_t_ Dch_ParThData_t;
+struct Dch_ParThData_t_
+{
+    Dch_Man_t *     p;            // manager with the SAT solver of this thread
+    Vec_Ptr_t *     vPairs;       // candidate pairs of the reduced AIG
+    int *           pStatus;      // the status of each pair (1 = proved, 0 = disproved, -1 = undecided)
+    int             iBeg;         // the first pair of this thread
+    int             iEnd;         // the pair following the last one
+    unsigned *      pPats;        // counter-examples (one bit for each CI)
+    int             nCexes;       // the number of counter-examples
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the speculatively reduced AIG.]
+
+  Description [Each node having a representative is replaced by the
+  representative, unless the pair is in pReprsExcl. For each pair whose
+  nodes are structurally different in the reduced AIG, pushes the two
+  nodes of the reduced AIG into vPairs and the original node into vNodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Man_t * Dch_ManParSpecReduce( Dch_Man_t * p, Aig_Obj_t ** pReprsExcl, Vec_Ptr_t * vPairs, Vec_Ptr_t * vNodes )
+{
+    Aig_Man_t * pAig = p->pAigTotal, * pSpec;
+    Aig_Obj_t * pObj, * pRepr, * pObjNew, * pReprNew;
+    int i;
+    Vec_PtrClear( vPairs );
+    Vec_PtrClear( vNodes );
+    pSpec = Aig_ManStart( Aig_ManObjNumMax(pAig) );
+    Aig_ManCleanData( pAig );
+    Aig_ManConst1(pAig)->pData = Aig_ManConst1(pSpec);
+    Aig_ManForEachCi( pAig, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pSpec );
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        pObjNew = Aig_And( pSpec, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        pObj->pData = pObjNew;
+        pRepr = Aig_ObjRepr( pAig, pObj );
+        if ( pRepr == NULL || pReprsExcl[pObj->Id] == pRepr )
+            continue;
+        pReprNew = (Aig_Obj_t *)pRepr->pData;
+        pObj->pData = Aig_NotCond( pReprNew, pObj->fPhase ^ pRepr->fPhase );
+        if ( Aig_Regular(pObjNew) == Aig_Regular(pReprNew) )
+            continue;
+        // the node with the smaller ID (possibly, the constant) goes first
+        if ( Aig_Regular(pObjNew)->Id < Aig_Regular(pReprNew)->Id )
+            ABC_SWAP( Aig_Obj_t *, pObjNew, pReprNew );
+        Vec_PtrPush( vPairs, Aig_Regular(pReprNew) );
+        Vec_PtrPush( vPairs, Aig_Regular(pObjNew) );
+        Vec_PtrPush( vNodes, pObj );
+    }
+    return pSpec;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the manager of one thread.]
+
+  Description [The manager shares the parameters with the main manager
+  and has its own SAT solver for the speculatively reduced AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Dch_Man_t * Dch_ManParStart( Dch_Man_t * pMain, Aig_Man_t * pSpec )
+{
+    Dch_Man_t * p;
+    p = ABC_CALLOC( Dch_Man_t, 1 );
+    p->pPars        = pMain->pPars;
+    p->pAigTotal    = pSpec;
+    p->pAigFraig    = pSpec;
+    p->nSatVars     = 1;
+    p->pSatVars     = ABC_CALLOC( int, Aig_ManObjNumMax(pSpec) );
+    p->vUsedNodes   = Vec_PtrAlloc( 1000 );
+    p->vFanins      = Vec_PtrAlloc( 100 );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the manager of one thread.]
+
+  Description [Adds the SAT call statistics to the main manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dch_ManParStop( Dch_Man_t * p, Dch_Man_t * pMain )
+{
+    pMain->nSatCalls      += p->nSatCalls;
+    pMain->nSatProof      += p->nSatProof;
+    pMain->nSatFailsReal  += p->nSatFailsReal;
+    pMain->nSatCallsUnsat += p->nSatCallsUnsat;
+    pMain->nSatCallsSat   += p->nSatCallsSat;
+    pMain->nRecycles      += p->nRecycles;
+    if ( p->pSat )
+        sat_solver_delete( p->pSat );
+    Vec_PtrFree( p->vUsedNodes );
+    Vec_PtrFree( p->vFanins );
+    ABC_FREE( p->pSatVars );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the candidate pairs of one thread.]
+
+  Description [Stops after 32 counter-examples, which fill one word of
+  simulation info. The status array is shared, but each thread writes
+  only the entries of its own pairs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Dch_ManParWorkerThread( void * pArg )
+{
+    Dch_ParThData_t * pThData = (Dch_ParThData_t *)pArg;
+    Dch_Man_t * p = pThData->p;
+    Aig_Obj_t * pOld, * pNew, * pCi;
+    int i, k, iVar;
+    for ( i = pThData->iBeg; i < pThData->iEnd && pThData->nCexes < 32; i++ )
+    {
+        pOld = (Aig_Obj_t *)Vec_PtrEntry( pThData->vPairs, 2*i );
+        pNew = (Aig_Obj_t *)Vec_PtrEntry( pThData->vPairs, 2*i+1 );
+        pThData->pStatus[i] = Dch_NodesAreEquiv( p, pOld, pNew );
+        if ( pThData->pStatus[i] != 0 )
+            continue;
+        // the CIs not in the cone of the pair are set to 0
+        Aig_ManForEachCi( p->pAigTotal, pCi, k )
+        {
+            iVar = Dch_ObjSatNum( p, pCi );
+            if ( iVar && sat_solver_var_value( p->pSat, iVar ) )
+                pThData->pPats[k] |= (1u << pThData->nCexes);
+        }
+        pThData->nCexes++;
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes using the counter-examples.]
+
+  Description [The counter-examples of each thread are placed into one
+  word of simulation info. The remaining bits are random.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dch_ManParRefine( Dch_Man_t * p, Dch_ParThData_t * pThData, int nProcs, Vec_Ptr_t * vSims, Vec_Ptr_t * vRoots )
+{
+    Aig_Obj_t * pObj;
+    unsigned * pSim, uMask;
+    int i, k;
+    // assign the counter-examples to the CIs
+    Aig_ManForEachCi( p->pAigTotal, pObj, i )
+    {
+        pSim = (unsigned *)Vec_PtrEntry( vSims, pObj->Id );
+        for ( k = 0; k < nProcs; k++ )
+        {
+            uMask = pThData[k].nCexes == 32 ? ~(unsigned)0 : (1u << pThData[k].nCexes) - 1;
+            pSim[k] = (pThData[k].pPats[i] & uMask) | (Aig_ManRandom(0) & ~uMask);
+        }
+    }
+    Dch_PerformSimulation( p->pAigTotal, vSims );
+    // refine the classes
+    Dch_ClassesSetData( p->ppClasses, vSims, Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
+    Dch_ClassesRefine( p->ppClasses );
+    Vec_PtrClear( vRoots );
+    Aig_ManForEachObj( p->pAigTotal, pObj, i )
+        if ( Dch_ObjIsConst1Cand( p->pAigTotal, pObj ) )
+            Vec_PtrPush( vRoots, pObj );
+    Dch_ClassesRefineConst1Group( p->ppClasses, vRoots, 1 );
+    Dch_ClassesSetData( p->ppClasses, NULL, NULL, Dch_NodeIsConstCex, Dch_NodesAreEqualCex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves the candidate equivalences with several solvers.]
+
+  Description [In each round, the main thread derives the speculatively
+  reduced AIG, in which the nodes are replaced by their representatives,
+  and collects the pairs that are not structurally equal in it. The pairs
+  are divided into contiguous chunks, one for each thread, and each thread
+  solves its chunk with its own SAT solver, until 32 counter-examples are
+  found. A counter-example of the reduced AIG distinguishes at least one
+  pair of the original AIG, so the main thread refines the classes by
+  simulating the counter-examples and starts the next round. Otherwise,
+  the undecided pairs are excluded from the reduction. When all pairs are
+  proved in one round, the candidate equivalences hold by induction on
+  the topological order and are recorded in p->pReprsPar. The choices are
+  not derived here: the sweep performed by Dch_ManSweep() afterwards
+  merges these pairs without calling the SAT solver. Because the division
+  of the pairs depends only on the AIG and the number of threads, the
+  result does not depend on the scheduling of the threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSweepPar( Dch_Man_t * p )
+{
+    pthread_t WorkerThread[DCH_THR_MAX];
+    Dch_ParThData_t ThData[DCH_THR_MAX];
+    Aig_Man_t * pAig = p->pAigTotal, * pSpec;
+    Aig_Obj_t ** pReprsExcl;
+    Aig_Obj_t * pObj, * pRepr;
+    Vec_Ptr_t * vPairs, * vNodes, * vSims, * vRoots;
+    int * pStatus = NULL;
+    int i, k, status, nPairs, nRounds = 0, nCexes = 0, nCexesAll = 0, nUndec, nProved = 0;
+    int nProcs = Abc_MinInt( p->pPars->nProcs, DCH_THR_MAX );
+    abctime clk, clkTotal = Abc_Clock();
+    assert( p->pReprsPar == NULL );
+    p->pReprsPar = ABC_CALLOC( Aig_Obj_t *, Aig_ManObjNumMax(pAig) );
+    pReprsExcl   = ABC_CALLOC( Aig_Obj_t *, Aig_ManObjNumMax(pAig) );
+    vPairs = Vec_PtrAlloc( 1000 );
+    vNodes = Vec_PtrAlloc( 1000 );
+    vRoots = Vec_PtrAlloc( 1000 );
+    vSims  = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(pAig), nProcs );
+    for ( k = 0; k < nProcs; k++ )
+        ThData[k].pPats = ABC_ALLOC( unsigned, Aig_ManCiNum(pAig) );
+    while ( 1 )
+    {
+        nRounds++;
+        // derive the reduced AIG and the pairs to be solved
+        pSpec  = Dch_ManParSpecReduce( p, pReprsExcl, vPairs, vNodes );
+        nPairs = Vec_PtrSize(vNodes);
+        pStatus = ABC_REALLOC( int, pStatus, nPairs + 1 );
+        // solve the pairs
+clk = Abc_Clock();
+        for ( k = 0; k < nProcs; k++ )
+        {
+            ThData[k].p       = Dch_ManParStart( p, pSpec );
+            ThData[k].vPairs  = vPairs;
+            ThData[k].pStatus = pStatus;
+            ThData[k].iBeg    = (int)((ABC_INT64_T)nPairs * k / nProcs);
+            ThData[k].iEnd    = (int)((ABC_INT64_T)nPairs * (k+1) / nProcs);
+            ThData[k].nCexes  = 0;
+            memset( ThData[k].pPats, 0, sizeof(unsigned) * Aig_ManCiNum(pAig) );
+            status = pthread_create( WorkerThread + k, NULL, Dch_ManParWorkerThread, (void *)(ThData + k) );  assert( status == 0 );
+        }
+        nCexes = 0;
+        for ( k = 0; k < nProcs; k++ )
+        {
+            pthread_join( WorkerThread[k], NULL );
+            Dch_ManParStop( ThData[k].p, p );
+            nCexes += ThData[k].nCexes;
+        }
+p->timeSat += Abc_Clock() - clk;
+        Aig_ManStop( pSpec );
+        nCexesAll += nCexes;
+        // refine the classes using the counter-examples
+        if ( nCexes )
+        {
+clk = Abc_Clock();
+            Dch_ManParRefine( p, ThData, nProcs, vSims, vRoots );
+p->timeSimSat += Abc_Clock() - clk;
+            continue;
+        }
+        // exclude the undecided pairs
+        nUndec = 0;
+        Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+            if ( pStatus[i] == -1 )
+            {
+                pReprsExcl[pObj->Id] = Aig_ObjRepr( pAig, pObj );
+                nUndec++;
+            }
+        if ( nUndec )
+            continue;
+        // all remaining pairs are proved
+        Aig_ManForEachNode( pAig, pObj, i )
+        {
+            pRepr = Aig_ObjRepr( pAig, pObj );
+            if ( pRepr == NULL || pReprsExcl[pObj->Id] == pRepr )
+                continue;
+            p->pReprsPar[pObj->Id] = pRepr;
+            nProved++;
+        }
+        break;
+    }
+    Aig_ManCleanData( pAig );
+    if ( p->pPars->fVerbose )
+    {
+        Abc_Print( 1, "Threads = %d. Rounds = %d. Proved = %d. Cexes = %d. ", nProcs, nRounds, nProved, nCexesAll );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    for ( k = 0; k < nProcs; k++ )
+        ABC_FREE( ThData[k].pPats );
+    Vec_PtrFree( vPairs );
+    Vec_PtrFree( vNodes );
+    Vec_PtrFree( vRoots );
+    Vec_PtrFree( vSims );
+    ABC_FREE( pStatus );
+    ABC_FREE( pReprsExcl );
+}
+
+#endif // pthreads are used
+
+
+#ifndef ABC_USE_PTHREADS
+
+void Dch_ManSweepPar( Dch_Man_t * p )
+{
+}
+
+#endif // pthreads are not used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
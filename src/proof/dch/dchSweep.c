@@ -70,7 +70,11 @@ void Dch_ManSweepNode( Dch_Man_t * p, Aig_Obj_t * pObj )
         return;
     }
     assert( Aig_Regular(pObjFraig) != Aig_ManConst1(p->pAigFraig) );
-    RetValue = Dch_NodesAreEquiv( p, Aig_Regular(pObjReprFraig), Aig_Regular(pObjFraig) );
+    // skip the equivalences already proved by the concurrent solvers
+    if ( p->pReprsPar && p->pReprsPar[pObj->Id] == pObjRepr )
+        RetValue = 1;
+    else
+        RetValue = Dch_NodesAreEquiv( p, Aig_Regular(pObjReprFraig), Aig_Regular(pObjFraig) );
     if ( RetValue == -1 ) // timed out
     {
         Dch_ObjSetFraig( pObj, NULL );
@@ -108,6 +112,9 @@ void Dch_ManSweep( Dch_Man_t * p )
     Bar_Progress_t * pProgress = NULL;
     Aig_Obj_t * pObj, * pObjNew;
     int i;
+    // prove the candidate equivalences with several solvers
+    if ( p->pPars->nProcs > 1 )
+        Dch_ManSweepPar( p );
     // map constants and PIs
     p->pAigFraig = Aig_ManStart( Aig_ManObjNumMax(p->pAigTotal) );
     Aig_ManCleanData( p->pAigTotal );
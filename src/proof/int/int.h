@@ -57,6 +57,7 @@ struct Inter_ManParams_t_
     int  fUsePudlak;    // use Pudluk interpolation procedure
     int  fUseOther;     // use other undisclosed option
     int  fUseMiniSat;   // use MiniSat-1.14p instead of internal proof engine
+    int  fUseProofFree; // compute interpolants during solving without storing the proof
     int  fCheckKstep;   // check using K-step induction
     int  fUseBias;      // bias decisions to global variables
     int  fUseBackward;  // perform backward interpolation
@@ -65,6 +66,7 @@ struct Inter_ManParams_t_
     int  fDropSatOuts;  // replace by 1 the solved outputs
     int  fDropInvar;    // dump inductive invariant into file
     int  fVerbose;      // print verbose statistics
+    int  nProcs;        // the number of unrolling depths solved concurrently
     int  iFrameMax;     // the time frame reached
     char * pFileName;   // file name to dump interpolant
 };
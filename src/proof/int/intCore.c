@@ -55,6 +55,7 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUsePudlak    = 0;     // use Pudluk interpolation procedure
     p->fUseOther     = 0;     // use other undisclosed option
     p->fUseMiniSat   = 0;     // use MiniSat-1.14p instead of internal proof engine
+    p->fUseProofFree = 0;     // compute interpolants during solving without storing the proof
     p->fCheckKstep   = 1;     // check using K-step induction
     p->fUseBias      = 0;     // bias decisions to global variables
     p->fUseBackward  = 0;     // perform backward interpolation
@@ -62,9 +63,65 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
     p->fVerbose      = 0;     // print verbose statistics
+    p->nProcs        = 1;     // the number of unrolling depths solved concurrently
     p->iFrameMax     =-1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts one interpolation sequence.]
+
+  Description [Derives the initial interpolant, the timeframes for the
+  current number of frames, and their CNFs. The number s is the index
+  of the sequence, used for printing.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Inter_ManStartFrames( Inter_Man_t * p, Inter_ManParams_t * pPars, int s )
+{
+    Aig_Man_t * pAigTemp;
+    abctime clk, clk2;
+clk2 = Abc_Clock();
+    // initial state
+    if ( pPars->fUseBackward )
+        p->pInter = Inter_ManStartOneOutput( p->pAig, 1 );
+    else
+        p->pInter = Inter_ManStartInitState( Aig_ManRegNum(p->pAig) );
+    assert( Aig_ManCoNum(p->pInter) == 1 );
+clk = Abc_Clock();
+    p->pCnfInter = Cnf_Derive( p->pInter, 0 );  
+p->timeCnf += Abc_Clock() - clk;    
+    // timeframes
+    p->pFrames = Inter_ManFramesInter( p->pAig, p->nFrames, pPars->fUseBackward, pPars->fUseTwoFrames );
+clk = Abc_Clock();
+    if ( pPars->fRewrite )
+    {
+        p->pFrames = Dar_ManRwsat( pAigTemp = p->pFrames, 1, 0 );
+        Aig_ManStop( pAigTemp );
+//        p->pFrames = Fra_FraigEquivence( pAigTemp = p->pFrames, 100, 0 );
+//        Aig_ManStop( pAigTemp );
+    }
+p->timeRwr += Abc_Clock() - clk;
+    // can also do SAT sweeping on the timeframes...
+clk = Abc_Clock();
+    if ( pPars->fUseBackward )
+        p->pCnfFrames = Cnf_Derive( p->pFrames, Aig_ManCoNum(p->pFrames) );  
+    else
+//        p->pCnfFrames = Cnf_Derive( p->pFrames, 0 );  
+        p->pCnfFrames = Cnf_DeriveSimple( p->pFrames, 0 );  
+p->timeCnf += Abc_Clock() - clk;    
+    // report statistics
+    if ( pPars->fVerbose )
+    {
+        printf( "Step = %2d. Frames = 1 + %d. And = %5d. Lev = %5d.  ", 
+            s+1, p->nFrames, Aig_ManNodeNum(p->pFrames), Aig_ManLevelNum(p->pFrames) );
+        ABC_PRT( "Time", Abc_Clock() - clk2 );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Interplates while the number of conflicts is not exceeded.]
@@ -103,6 +160,9 @@ int Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars,
         printf( "Property trivially fails in the initial state.\n" );
         return 0;
     }
+    // unroll several depths concurrently
+    if ( pPars->nProcs > 1 && !pPars->fTransLoop && !pPars->fUseBackward && !pPars->fUseMiniSat )
+        return Inter_ManPerformInterpolationPar( pAig, pPars, piFrame );
 /*
     if ( Inter_ManCheckAllStates(pAig) )
     {
@@ -136,43 +196,7 @@ p->timeCnf += Abc_Clock() - clk;
     {
         Cnf_Dat_t * pCnfInter2;
 
-clk2 = Abc_Clock();
-        // initial state
-        if ( pPars->fUseBackward )
-            p->pInter = Inter_ManStartOneOutput( pAig, 1 );
-        else
-            p->pInter = Inter_ManStartInitState( Aig_ManRegNum(pAig) );
-        assert( Aig_ManCoNum(p->pInter) == 1 );
-clk = Abc_Clock();
-        p->pCnfInter = Cnf_Derive( p->pInter, 0 );  
-p->timeCnf += Abc_Clock() - clk;    
-        // timeframes
-        p->pFrames = Inter_ManFramesInter( pAig, p->nFrames, pPars->fUseBackward, pPars->fUseTwoFrames );
-clk = Abc_Clock();
-        if ( pPars->fRewrite )
-        {
-            p->pFrames = Dar_ManRwsat( pAigTemp = p->pFrames, 1, 0 );
-            Aig_ManStop( pAigTemp );
-//        p->pFrames = Fra_FraigEquivence( pAigTemp = p->pFrames, 100, 0 );
-//        Aig_ManStop( pAigTemp );
-        }
-p->timeRwr += Abc_Clock() - clk;
-        // can also do SAT sweeping on the timeframes...
-clk = Abc_Clock();
-        if ( pPars->fUseBackward )
-            p->pCnfFrames = Cnf_Derive( p->pFrames, Aig_ManCoNum(p->pFrames) );  
-        else
-//            p->pCnfFrames = Cnf_Derive( p->pFrames, 0 );  
-            p->pCnfFrames = Cnf_DeriveSimple( p->pFrames, 0 );  
-p->timeCnf += Abc_Clock() - clk;    
-        // report statistics
-        if ( pPars->fVerbose )
-        {
-            printf( "Step = %2d. Frames = 1 + %d. And = %5d. Lev = %5d.  ", 
-                s+1, p->nFrames, Aig_ManNodeNum(p->pFrames), Aig_ManLevelNum(p->pFrames) );
-            ABC_PRT( "Time", Abc_Clock() - clk2 );
-        }
-
+        Inter_ManStartFrames( p, pPars, s );
 
         //////////////////////////////////////////
         // start containment checking
@@ -216,6 +240,9 @@ p->timeEqu += Abc_Clock() - clk;
             }
             else 
 #endif
+            if ( pPars->fUseProofFree )
+                RetValue = Inter_ManPerformOneStepSat2( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
+            else
                 RetValue = Inter_ManPerformOneStep( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
 
             if ( pPars->fVerbose )
@@ -70,6 +70,7 @@ struct Inter_Man_t_
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
     char *           pFileName;
+    int *            pstop;        // external flag to terminate SAT solving
     // runtime
     abctime          timeRwr;
     abctime          timeCnf;
@@ -112,6 +113,9 @@ extern Aig_Man_t *     Inter_ManStartOneOutput( Aig_Man_t * p, int fAddFirstPo )
 /*=== intFrames.c ============================================================*/
 extern Aig_Man_t *     Inter_ManFramesInter( Aig_Man_t * pAig, int nFrames, int fAddRegOuts, int fUseTwoFrames );
 
+/*=== intCore.c ============================================================*/
+extern void            Inter_ManStartFrames( Inter_Man_t * p, Inter_ManParams_t * pPars, int s );
+
 /*=== intMan.c ============================================================*/
 extern Inter_Man_t *   Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars );
 extern void            Inter_ManClean( Inter_Man_t * p );
@@ -125,6 +129,12 @@ extern int             Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, i
 extern int             Inter_ManPerformOneStepM114p( Inter_Man_t * p, int fUsePudlak, int fUseOther );
 #endif
 
+/*=== intPar.c ============================================================*/
+extern int             Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame );
+
+/*=== intSat2.c ============================================================*/
+extern int             Inter_ManPerformOneStepSat2( Inter_Man_t * p, int fUseBias, int fUseBackward, abctime nTimeNewOut );
+
 /*=== intUtil.c ============================================================*/
 extern int             Inter_ManCheckInitialState( Aig_Man_t * p );
 extern int             Inter_ManCheckAllStates( Aig_Man_t * p );
@@ -0,0 +1,413 @@
+/**CFile****************************************************************
+
+  FileName    [intPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Interpolation with several unrolling depths solved concurrently.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: intPar.c,v 1.0 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "sat/bmc/bmc.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define INTER_THR_MAX 64
+
+// one interpolation sequence solved by a thread
+typedef struct Inter_ParRun_t_ Inter_ParRun_t;
+struct Inter_ParRun_t_
+{
+    Inter_Man_t *       p;            // interpolation manager of this sequence
+    Inter_Check_t *     pCheck;       // containment checking manager
+    Inter_ManParams_t * pPars;        // parameters
+    Inter_ParRun_t *    pRuns;        // all runs
+    int                 nRuns;        // the number of runs
+    int                 fStop;        // the flag to stop the SAT run
+    abctime             nTimeNewOut;  // timeout
+    int                 iStep;        // the interpolation step in the sequence
+    int                 fActive;      // the sequence is still running
+    int                 RetValue;     // the result of the last step
+    abctime             clkStep;      // the runtime of the last step
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one interpolation step of one sequence.]
+
+  Description [Only the SAT run and the interpolant derivation are done
+  here. Everything that uses CNF derivation or AIG rewriting (both rely
+  on static data) is done by the main thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Inter_ManParWorkerThread( void * pArg )
+{
+    Inter_ParRun_t * pRun = (Inter_ParRun_t *)pArg;
+    abctime clk = Abc_Clock();
+    if ( pRun->pPars->fUseProofFree )
+        pRun->RetValue = Inter_ManPerformOneStepSat2( pRun->p, pRun->pPars->fUseBias, 0, pRun->nTimeNewOut );
+    else
+        pRun->RetValue = Inter_ManPerformOneStep( pRun->p, pRun->pPars->fUseBias, 0, pRun->nTimeNewOut );
+    // the counter-example of the first step is real: deeper runs can stop
+    if ( pRun->RetValue == 0 && pRun->iStep == 0 )
+    {
+        int k;
+        for ( k = 0; k < pRun->nRuns; k++ )
+            if ( pRun->pRuns[k].p->nFrames > pRun->p->nFrames )
+                pRun->pRuns[k].fStop = 1;
+    }
+    pRun->clkStep = Abc_Clock() - clk;
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the interpolation sequence of one run.]
+
+  Description [Derives the timeframes for the current number of frames
+  and checks the initial state against the containment manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Inter_ManParStartSequence( Inter_ParRun_t * pRun, int s )
+{
+    Inter_Man_t * p = pRun->p;
+    Cnf_Dat_t * pCnfInter2;
+    abctime clk;
+    Inter_ManStartFrames( p, pRun->pPars, s );
+    pRun->pCheck = Inter_CheckStart( p->pAigTrans, pRun->pPars->nFramesK );
+clk = Abc_Clock();
+    pCnfInter2 = Cnf_Derive( p->pInter, 1 );
+p->timeCnf += Abc_Clock() - clk;
+clk = Abc_Clock();
+    Inter_CheckPerform( pRun->pCheck, pCnfInter2, pRun->nTimeNewOut );
+p->timeEqu += Abc_Clock() - clk;
+    Cnf_DataFree( pCnfInter2 );
+    if ( p->vInters )
+        Vec_PtrPush( p->vInters, Aig_ManDupSimple(p->pInter) );
+    pRun->iStep = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops all runs.]
+
+  Description [Only the run iWinner prints statistics and dumps the
+  interpolants.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Inter_ManParStop( Inter_ParRun_t * pRuns, int nProcs, int iWinner, int fProved, abctime clkTotal )
+{
+    Aig_Man_t * pMan;
+    int k, i;
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Inter_Man_t * p = pRuns[k].p;
+        p->timeTotal = Abc_Clock() - clkTotal;
+        if ( k != iWinner )
+        {
+            p->fVerbose = 0;
+            if ( p->vInters )
+            {
+                Vec_PtrForEachEntry( Aig_Man_t *, p->vInters, pMan, i )
+                    Aig_ManStop( pMan );
+                Vec_PtrFreeP( &p->vInters );
+            }
+        }
+        Inter_ManStop( p, fProved );
+        Inter_CheckStop( pRuns[k].pCheck );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Interpolates with several unrolling depths at the same time.]
+
+  Description [Each run performs the interpolation sequence of the serial
+  procedure with its own number of frames (1, 2, ..., nProcs in the
+  beginning). In each round, the next SAT call and interpolant derivation
+  of every active run are performed by a separate thread. Then the
+  results are processed in the main thread in the order of the runs.
+  A run that finds a spurious counter-example restarts with more frames
+  than all other runs. A real counter-example stops only the deeper runs,
+  so the reported frame does not depend on thread timing. Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    pthread_t WorkerThread[INTER_THR_MAX];
+    Inter_ParRun_t Runs[INTER_THR_MAX], * pRun;
+    Inter_Man_t * p;
+    Aig_Man_t * pAigTemp;
+    Cnf_Dat_t * pCnfInter2;
+    int nProcs = Abc_MinInt( pPars->nProcs, INTER_THR_MAX );
+    int nSeqs = 0, nFramesNext, nActive, iCex, k, status, Status;
+    abctime clk, clkTotal = Abc_Clock();
+    abctime nTimeNewOut = pPars->nSecLimit ? pPars->nSecLimit * CLOCKS_PER_SEC + Abc_Clock() : 0;
+
+    assert( !pPars->fTransLoop && !pPars->fUseBackward && pPars->nFramesK == 1 );
+    *piFrame = -1;
+    if ( pPars->fVerbose )
+        printf( "Running %d interpolation sequences with different unrolling depths concurrently.\n", nProcs );
+
+    // create interpolation managers
+    memset( Runs, 0, sizeof(Inter_ParRun_t) * nProcs );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        pRun = Runs + k;
+        pRun->pPars       = pPars;
+        pRun->pRuns       = Runs;
+        pRun->nRuns       = nProcs;
+        pRun->nTimeNewOut = nTimeNewOut;
+        pRun->fActive     = 1;
+        pRun->p = p = Inter_ManCreate( pAig, pPars );
+        p->pAigTrans = Inter_ManStartDuplicated( pAig );
+clk = Abc_Clock();
+        p->pCnfAig = Cnf_Derive( p->pAigTrans, Aig_ManRegNum(p->pAigTrans) );
+p->timeCnf += Abc_Clock() - clk;
+        p->pstop = &pRun->fStop;
+        p->nFrames = k + 1;
+        if ( pPars->fVerbose && k == 0 )
+        {
+            printf( "AIG: PI/PO/Reg = %d/%d/%d. And = %d. Lev = %d.  CNF: Var/Cla = %d/%d.\n",
+                Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
+                Aig_ManAndNum(pAig), Aig_ManLevelNum(pAig),
+                p->pCnfAig->nVars, p->pCnfAig->nClauses );
+        }
+        Inter_ManParStartSequence( pRun, nSeqs++ );
+    }
+    nFramesNext = nProcs + 1;
+
+    // iterate rounds of interpolation steps
+    while ( 1 )
+    {
+        // check the limit on the number of frames
+        nActive = 0;
+        for ( k = 0; k < nProcs; k++ )
+        {
+            pRun = Runs + k;
+            if ( pRun->fActive && pPars->nFramesMax && pRun->p->nFrames + pRun->iStep >= pPars->nFramesMax )
+                pRun->fActive = 0;
+            nActive += pRun->fActive;
+        }
+        if ( nActive == 0 )
+        {
+            if ( pPars->fVerbose )
+                printf( "Reached limit on the number of timeframes or conflicts in all runs.\n" );
+            Inter_ManParStop( Runs, nProcs, 0, 0, clkTotal );
+            return -1;
+        }
+
+        // perform one interpolation step of each run
+        for ( k = 0; k < nProcs; k++ )
+            Runs[k].fStop = 0;
+        for ( k = 0; k < nProcs; k++ )
+            if ( Runs[k].fActive )
+            {
+                status = pthread_create( WorkerThread + k, NULL, Inter_ManParWorkerThread, (void *)(Runs + k) );  assert( status == 0 );
+            }
+        for ( k = 0; k < nProcs; k++ )
+            if ( Runs[k].fActive )
+                pthread_join( WorkerThread[k], NULL );
+
+        // a counter-example in the first step of a sequence is real
+        iCex = -1;
+        for ( k = 0; k < nProcs; k++ )
+            if ( Runs[k].fActive && Runs[k].RetValue == 0 && Runs[k].iStep == 0 )
+                if ( iCex == -1 || Runs[k].p->nFrames < Runs[iCex].p->nFrames )
+                    iCex = k;
+        if ( iCex >= 0 )
+        {
+            Saig_ParBmc_t ParsBmc, * pParsBmc = &ParsBmc;
+            p = Runs[iCex].p;
+            if ( pPars->fVerbose )
+                printf( "Found a real counterexample in frame %d (run %d).\n", p->nFrames, iCex );
+            *piFrame = p->nFrames;
+            pPars->iFrameMax = p->nFrames - 1;
+            Saig_ParBmcSetDefaultParams( pParsBmc );
+            pParsBmc->nConfLimit = 100000000;
+            pParsBmc->nStart     = p->nFrames;
+            pParsBmc->fVerbose   = pPars->fVerbose;
+            status = Saig_ManBmcScalable( pAig, pParsBmc );
+            if ( status == 1 )
+                printf( "Error: The problem should be SAT but it is UNSAT.\n" );
+            else if ( status == -1 )
+                printf( "Error: The problem timed out.\n" );
+            Inter_ManParStop( Runs, nProcs, iCex, 0, clkTotal );
+            return 0;
+        }
+
+        // process the results in the order of the runs
+        for ( k = 0; k < nProcs; k++ )
+        {
+            pRun = Runs + k;
+            p = pRun->p;
+            if ( !pRun->fActive )
+                continue;
+            if ( pPars->fVerbose )
+            {
+                printf( "   R = %2d. I = %2d. Bmc =%3d. IntAnd =%6d. IntLev =%5d. Conf =%6d.  ",
+                    k, pRun->iStep+1, pRun->iStep + 1 + p->nFrames, Aig_ManNodeNum(p->pInter), Aig_ManLevelNum(p->pInter), p->nConfCur );
+                ABC_PRT( "Time", pRun->clkStep );
+            }
+            // remember the number of timeframes completed
+            pPars->iFrameMax = Abc_MaxInt( pPars->iFrameMax, pRun->iStep - 1 + p->nFrames );
+            if ( pRun->RetValue == 0 ) // spurious counter-example
+            {
+                Inter_ManClean( p );
+                Inter_CheckStop( pRun->pCheck );
+                p->nFrames = Abc_MaxInt( p->nFrames + pRun->iStep, nFramesNext );
+                nFramesNext = p->nFrames + 1;
+                Inter_ManParStartSequence( pRun, nSeqs++ );
+                continue;
+            }
+            if ( pRun->RetValue == -1 )
+            {
+                if ( pPars->nSecLimit && Abc_Clock() > nTimeNewOut ) // timed out
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
+                    Inter_ManParStop( Runs, nProcs, k, 0, clkTotal );
+                    return -1;
+                }
+                if ( pPars->fVerbose )
+                    printf( "Reached limit (%d) on the number of conflicts in run %d.\n", p->nConfLimit, k );
+                pRun->fActive = 0;
+                continue;
+            }
+            assert( pRun->RetValue == 1 ); // found new interpolant
+            // compress the interpolant
+clk = Abc_Clock();
+            if ( p->pInterNew )
+            {
+                p->pInterNew->Time2Quit = nTimeNewOut;
+                p->pInterNew = Dar_ManRwsat( pAigTemp = p->pInterNew, 1, 0 );
+                Aig_ManStop( pAigTemp );
+                if ( p->pInterNew == NULL )
+                {
+                    printf( "Reached timeout (%d seconds) during rewriting.\n",  pPars->nSecLimit );
+                    Inter_ManParStop( Runs, nProcs, k, 1, clkTotal );
+                    return -1;
+                }
+            }
+p->timeRwr += Abc_Clock() - clk;
+            // check if interpolant is trivial
+            if ( p->pInterNew == NULL || Aig_ObjChild0(Aig_ManCo(p->pInterNew,0)) == Aig_ManConst0(p->pInterNew) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "The problem is trivially true for all states.\n" );
+                Inter_ManParStop( Runs, nProcs, k, 1, clkTotal );
+                return 1;
+            }
+            // check containment of interpolants
+clk = Abc_Clock();
+            if ( Aig_ManCiNum(p->pInterNew) != Aig_ManCiNum(p->pInter) )
+                Status = 0;
+            else if ( pPars->fCheckKstep ) // k-step unique-state induction
+            {
+                pCnfInter2 = Cnf_Derive( p->pInterNew, 1 );
+                Status = Inter_CheckPerform( pRun->pCheck, pCnfInter2, nTimeNewOut );
+                Cnf_DataFree( pCnfInter2 );
+                if ( p->vInters )
+                    Vec_PtrPush( p->vInters, Aig_ManDupSimple(p->pInterNew) );
+            }
+            else // combinational containment
+                Status = Inter_ManCheckContainment( p->pInterNew, p->pInter );
+p->timeEqu += Abc_Clock() - clk;
+            if ( Status ) // contained
+            {
+                if ( pPars->fVerbose )
+                    printf( "Proved containment of interpolants (run %d).\n", k );
+                Inter_ManParStop( Runs, nProcs, k, 1, clkTotal );
+                return 1;
+            }
+            if ( pPars->nSecLimit && Abc_Clock() > nTimeNewOut )
+            {
+                printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
+                Inter_ManParStop( Runs, nProcs, k, 1, clkTotal );
+                return -1;
+            }
+            // save interpolant and convert it into CNF
+            Aig_ManStop( p->pInter );
+            p->pInter = p->pInterNew;
+            p->pInterNew = NULL;
+            Cnf_DataFree( p->pCnfInter );
+clk = Abc_Clock();
+            p->pCnfInter = Cnf_Derive( p->pInter, 0 );
+p->timeCnf += Abc_Clock() - clk;
+            pRun->iStep++;
+        }
+    }
+    assert( 0 );
+    return -1;
+}
+
+#endif // pthreads are used
+
+
+#ifndef ABC_USE_PTHREADS
+
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    pPars->nProcs = 1;
+    return Inter_ManPerformInterpolation( pAig, pPars, piFrame );
+}
+
+#endif // pthreads are not used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
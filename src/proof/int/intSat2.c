@@ -0,0 +1,297 @@
+/**CFile****************************************************************
+
+  FileName    [intSat2.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Proof-free interpolation using on-the-fly interpolants of SAT solver 2.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: intSat2.c,v 1.0 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "sat/bsat/satSolver2.h"
+#include "aig/gia/giaAig.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one clause to the solver.]
+
+  Description [Returns the clause handle, or -1 if all literals of the
+  clause are false at the top level (sat_solver2 does not accept such
+  clauses).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Inter_ManSat2AddClause( sat_solver2 * pSat, lit * pBeg, lit * pEnd, int fPartA )
+{
+    lit * pLit;
+    int Cid;
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+        if ( pSat->assigns[lit_var(*pLit)] != !lit_sign(*pLit) )
+            break;
+    if ( pLit == pEnd )
+        return -1;
+    Cid = sat_solver2_addclause( pSat, pBeg, pEnd, -1 );
+    if ( fPartA )
+        clause2_set_partA( pSat, Cid, 1 );
+    return Cid;
+}
+static inline int Inter_ManSat2AddBuffer( sat_solver2 * pSat, int iVarA, int iVarB )
+{
+    lit Lits[2];
+    Lits[0] = toLitCond( iVarA, 0 );
+    Lits[1] = toLitCond( iVarB, 1 );
+    if ( Inter_ManSat2AddClause( pSat, Lits, Lits + 2, 1 ) == -1 )
+        return 0;
+    Lits[0] = toLitCond( iVarA, 1 );
+    Lits[1] = toLitCond( iVarB, 0 );
+    if ( Inter_ManSat2AddClause( pSat, Lits, Lits + 2, 1 ) == -1 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of the CNF to the solver.]
+
+  Description [Adds only the unit clauses if fUnits is 1, or only the
+  other clauses otherwise. Returns 0 if a clause is false at the top
+  level.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Inter_ManSat2AddCnf( sat_solver2 * pSat, Cnf_Dat_t * pCnf, int fPartA, int fUnits )
+{
+    int i;
+    for ( i = 0; i < pCnf->nClauses; i++ )
+    {
+        if ( (pCnf->pClauses[i+1] - pCnf->pClauses[i] == 1) != fUnits )
+            continue;
+        if ( Inter_ManSat2AddClause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1], fPartA ) == -1 )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT solver for one interpolation run.]
+
+  Description [Same problem as in Inter_ManDeriveSatSolver(). All variables
+  of the interpolant and of the one-frame CNF belong to A. The clauses
+  of A are marked and the interpolation manager is attached to the
+  solver, so that the interpolant is computed during conflict analysis.
+  The unit clauses are added last. Otherwise, sat_solver2 would replace
+  a clause made unit by earlier units with a derived clause, before the
+  clause is marked as belonging to A, and its interpolant would be wrong.
+  Returns NULL if one of the clauses is false at the top level.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+sat_solver2 * Inter_ManDeriveSatSolver2(
+    Aig_Man_t * pInter, Cnf_Dat_t * pCnfInter,
+    Aig_Man_t * pAig, Cnf_Dat_t * pCnfAig,
+    Aig_Man_t * pFrames, Cnf_Dat_t * pCnfFrames,
+    Vec_Int_t * vVarsAB, int fUseBackward )
+{
+    sat_solver2 * pSat;
+    Aig_Obj_t * pObj, * pObj2;
+    int i, nVars, RetValue = 1;
+
+    // sanity checks
+    assert( Aig_ManRegNum(pInter) == 0 );
+    assert( Aig_ManRegNum(pAig) > 0 );
+    assert( Aig_ManRegNum(pFrames) == 0 );
+    assert( Aig_ManCoNum(pInter) == 1 );
+    assert( fUseBackward || Aig_ManCiNum(pInter) == Aig_ManRegNum(pAig) );
+
+    // prepare CNFs
+    Cnf_DataLift( pCnfAig,   pCnfFrames->nVars );
+    Cnf_DataLift( pCnfInter, pCnfFrames->nVars + pCnfAig->nVars );
+
+    // start the solver
+    nVars = pCnfInter->nVars + pCnfAig->nVars + pCnfFrames->nVars;
+    pSat = sat_solver2_new();
+    sat_solver2_setnvars( pSat, nVars );
+    for ( i = pCnfFrames->nVars; i < nVars; i++ )
+        var_set_partA( pSat, i, 1 );
+
+    // add clauses of A
+    // interpolant
+    RetValue = Inter_ManSat2AddCnf( pSat, pCnfInter, 1, 0 );
+    // connector clauses
+    if ( fUseBackward )
+    {
+        Saig_ManForEachLi( pAig, pObj2, i )
+        {
+            if ( !RetValue )
+                break;
+            if ( Saig_ManRegNum(pAig) == Aig_ManCiNum(pInter) )
+                pObj = Aig_ManCi( pInter, i );
+            else
+            {
+                assert( Aig_ManCiNum(pAig) == Aig_ManCiNum(pInter) );
+                pObj = Aig_ManCi( pInter, Aig_ManCiNum(pAig)-Saig_ManRegNum(pAig) + i );
+            }
+            RetValue = Inter_ManSat2AddBuffer( pSat, pCnfInter->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] );
+        }
+    }
+    else
+    {
+        Aig_ManForEachCi( pInter, pObj, i )
+        {
+            if ( !RetValue )
+                break;
+            pObj2 = Saig_ManLo( pAig, i );
+            RetValue = Inter_ManSat2AddBuffer( pSat, pCnfInter->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] );
+        }
+    }
+    // one timeframe
+    if ( RetValue )
+        RetValue = Inter_ManSat2AddCnf( pSat, pCnfAig, 1, 0 );
+    // connector clauses
+    Vec_IntClear( vVarsAB );
+    if ( fUseBackward )
+    {
+        Aig_ManForEachCo( pFrames, pObj, i )
+        {
+            assert( pCnfFrames->pVarNums[pObj->Id] >= 0 );
+            Vec_IntPush( vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+            pObj2 = Saig_ManLo( pAig, i );
+            if ( RetValue )
+                RetValue = Inter_ManSat2AddBuffer( pSat, pCnfFrames->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] );
+        }
+    }
+    else
+    {
+        Aig_ManForEachCi( pFrames, pObj, i )
+        {
+            if ( i == Aig_ManRegNum(pAig) )
+                break;
+            Vec_IntPush( vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+            pObj2 = Saig_ManLi( pAig, i );
+            if ( RetValue )
+                RetValue = Inter_ManSat2AddBuffer( pSat, pCnfFrames->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] );
+        }
+    }
+    // add clauses of B
+    if ( RetValue )
+        RetValue = Inter_ManSat2AddCnf( pSat, pCnfFrames, 0, 0 );
+    // add unit clauses
+    if ( RetValue )
+        RetValue = Inter_ManSat2AddCnf( pSat, pCnfInter, 1, 1 ) && Inter_ManSat2AddCnf( pSat, pCnfAig, 1, 1 ) && Inter_ManSat2AddCnf( pSat, pCnfFrames, 0, 1 );
+    // return clauses to the original state
+    Cnf_DataLift( pCnfAig, -pCnfFrames->nVars );
+    Cnf_DataLift( pCnfInter, -pCnfFrames->nVars -pCnfAig->nVars );
+    if ( !RetValue )
+    {
+        sat_solver2_delete( pSat );
+        return NULL;
+    }
+    // start the interpolation manager (global variables are the AB-variables)
+    pSat->pInt2 = Int2_ManStart( pSat, Vec_IntArray(vVarsAB), Vec_IntSize(vVarsAB) );
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one SAT run with proof-free interpolation.]
+
+  Description [The interpolant is accumulated in the clauses during
+  conflict analysis, so no resolution proof is stored and replayed.
+  Falls back to Inter_ManPerformOneStep() if the problem is solved while
+  the clauses are being added. Returns 1 if proven. 0 if failed.
+  -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformOneStepSat2( Inter_Man_t * p, int fUseBias, int fUseBackward, abctime nTimeNewOut )
+{
+    sat_solver2 * pSat;
+    Gia_Man_t * pGia;
+    int status, RetValue;
+    abctime clk;
+
+    // derive the SAT solver
+    pSat = Inter_ManDeriveSatSolver2( p->pInter, p->pCnfInter, p->pAigTrans, p->pCnfAig, p->pFrames, p->pCnfFrames, p->vVarsAB, fUseBackward );
+    if ( pSat == NULL )
+        return Inter_ManPerformOneStep( p, fUseBias, fUseBackward, nTimeNewOut );
+
+    // set runtime limit
+    if ( nTimeNewOut )
+        sat_solver2_set_runtime_limit( pSat, nTimeNewOut );
+    sat_solver2_set_stop( pSat, p->pstop );
+
+    // solve the problem
+clk = Abc_Clock();
+    status = sat_solver2_solve( pSat, NULL, NULL, (ABC_INT64_T)p->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    p->nConfCur = sat_solver2_nconflicts( pSat );
+p->timeSat += Abc_Clock() - clk;
+
+    if ( status == l_False )
+        RetValue = 1;
+    else if ( status == l_True )
+        RetValue = 0;
+    else
+        RetValue = -1;
+    if ( RetValue != 1 )
+    {
+        sat_solver2_delete( pSat );
+        return RetValue;
+    }
+
+    // read the interpolant
+clk = Abc_Clock();
+    pGia = (Gia_Man_t *)Int2_ManReadInterpolant( pSat );
+    sat_solver2_delete( pSat );
+    if ( pGia == NULL )
+    {
+p->timeInt += Abc_Clock() - clk;
+        return -1;
+    }
+    assert( Gia_ManCiNum(pGia) == Vec_IntSize(p->vVarsAB) );
+    p->pInterNew = Gia_ManToAigSimple( pGia );
+    Gia_ManStop( pGia );
+p->timeInt += Abc_Clock() - clk;
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -372,6 +372,8 @@ static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p,
     sat_solver_set_runtime_limit( pSat, p->timeToStop );
     sat_solver_set_runid( pSat, p->pPars->RunId );
     sat_solver_set_stop_func( pSat, p->pPars->pFuncStop );
+    if ( p->pShare )
+        sat_solver_set_stop( pSat, Pdr_ManShareStopFlag(p) );
     return pSat;
 }
 
@@ -422,6 +424,8 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
     sat_solver_set_runtime_limit( pSat, p->timeToStop );
     sat_solver_set_runid( pSat, p->pPars->RunId );
     sat_solver_set_stop_func( pSat, p->pPars->pFuncStop );
+    if ( p->pShare )
+        sat_solver_set_stop( pSat, Pdr_ManShareStopFlag(p) );
     return pSat;
 }
 
@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs         =       1;  // the number of threads sharing clauses
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -986,6 +987,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
                     p->nAbsFlops++;
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
             }
+            if ( p->pShare )
+                Pdr_ManShareExport( p, k, pCubeMin );
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -1016,6 +1019,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( p->pShare && Pdr_ManShareStopped(p) )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1142,6 +1147,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     p->pPars->iFrame = iFrame;
                     return -1;
                 }
+                if ( p->pShare )
+                    Pdr_ManShareImport( p );
                 RetValue = Pdr_ManCheckCube( p, iFrame, NULL, &pCube, p->pPars->nConfLimit, 0, 1 );
                 if ( RetValue == 1 )
                     break;
@@ -1281,6 +1288,13 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        // add the clauses known to be inductive
+        if ( iFrame == 1 && p->pPars->vInvSeed && !p->pPars->fUseAbs )
+        {
+            int nSeeded = Pdr_ManSeedClauses( p, iFrame, p->pPars->vInvSeed );
+            if ( p->pPars->fVerbose )
+                Abc_Print( 1, "Seeded frame %d with %d inductive clauses.\n", iFrame, nSeeded );
+        }
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
@@ -1337,6 +1351,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             p->pPars->iFrame = iFrame;
             return -1;
         }
+        if ( p->pShare && Pdr_ManShareStopped(p) )
+        {
+            p->pPars->iFrame = iFrame;
+            return -1;
+        }
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
         {
             if ( fPrintClauses )
@@ -1413,6 +1432,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
+    if ( pPars->nProcs > 1 && !pPars->fUseAbs )
+        return Pdr_ManSolvePar( pAig, pPars );
     p = Pdr_ManStart( pAig, pPars, NULL );
     RetValue = Pdr_ManSolveInt( p );
     if ( RetValue == 0 )
@@ -92,6 +92,8 @@ struct Pdr_Obl_t_
     Pdr_Obl_t * pLink;     // queue link
 };
 
+typedef struct Pdr_Shr_t_ Pdr_Shr_t;
+
 typedef struct Pdr_Man_t_ Pdr_Man_t;
 struct Pdr_Man_t_
 {
@@ -140,6 +142,10 @@ struct Pdr_Man_t_
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    // clause sharing
+    Pdr_Shr_t * pShare;    // clauses shared by the threads
+    int         iShareId;  // the thread number
+    int         iShareNext;// the next shared clause to import
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -211,11 +217,18 @@ extern Vec_Str_t *     Pdr_ManDumpString( Pdr_Man_t * p );
 extern void            Pdr_ManReportInvariant( Pdr_Man_t * p );
 extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
 extern Vec_Int_t *     Pdr_ManDeriveInfinityClauses( Pdr_Man_t * p, int fReduce );
+extern int             Pdr_ManSeedClauses( Pdr_Man_t * p, int k, Vec_Int_t * vInv );
 /*=== pdrMan.c ==========================================================*/
 extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit );
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern void            Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManShareImport( Pdr_Man_t * p );
+extern int             Pdr_ManShareStopped( Pdr_Man_t * p );
+extern int *           Pdr_ManShareStopFlag( Pdr_Man_t * p );
+extern int             Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
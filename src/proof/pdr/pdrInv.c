@@ -22,6 +22,8 @@
 #include "base/abc/abc.h"      // for Abc_NtkCollectCioNames()
 #include "base/main/main.h"    // for Abc_FrameReadGlobalFrame()
 #include "aig/ioa/ioa.h"
+#include "misc/extra/extra.h"
+#include "misc/util/utilNam.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -976,6 +978,284 @@ Vec_Int_t * Pdr_InvMinimizeLits( Gia_Man_t * p, Vec_Int_t * vInv, int fVerbose )
     return vRes;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the invariant written by Pdr_ManDumpClauses().]
+
+  Description [The columns of the PLA file are mapped to the flops of
+  the current design by name, using the names listed in line ".ilb".
+  If the file has no names, the columns are mapped by position, provided
+  that their number matches the number of flops. Cubes depending on the
+  flops not found in the current design are dropped. Returns the clauses
+  in the same format as Pdr_ManDeriveInfinityClauses().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Pdr_InvRead( char * pFileName, char ** pNamesFlop, int nRegs, int fVerbose )
+{
+    Vec_Int_t * vRes, * vMap = NULL;
+    Abc_Nam_t * pNames;
+    char * pContents, * pLine, * pNext, * pToken;
+    int i, iSize, nIns = -1, nCubes = 0, nDropped = 0, nUnmapped = 0;
+    pContents = Extra_FileReadContents( pFileName );
+    if ( pContents == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" with the invariant.\n", pFileName );
+        return NULL;
+    }
+    // hash the flop names of the current design
+    pNames = Abc_NamStart( nRegs, 24 );
+    for ( i = 0; pNamesFlop && i < nRegs; i++ )
+        Abc_NamStrFindOrAdd( pNames, pNamesFlop[i], NULL );
+    vRes = Vec_IntAlloc( 1000 );
+    Vec_IntPush( vRes, 0 );
+    for ( pLine = pContents; pLine; pLine = pNext )
+    {
+        pNext = strchr( pLine, '\n' );
+        if ( pNext )
+            *pNext++ = 0;
+        pToken = strtok( pLine, " \t\r" );
+        if ( pToken == NULL || pToken[0] == '#' )
+            continue;
+        if ( !strcmp(pToken, ".i") )
+        {
+            pToken = strtok( NULL, " \t\r" );
+            nIns = pToken ? atoi(pToken) : -1;
+            continue;
+        }
+        if ( !strcmp(pToken, ".ilb") )
+        {
+            // map each column into a flop (or -1 if the flop is not found)
+            Vec_IntFreeP( &vMap );
+            vMap = Vec_IntAlloc( 100 );
+            while ( (pToken = strtok( NULL, " \t\r" )) )
+            {
+                int iFlop = pNamesFlop ? Abc_NamStrFind( pNames, pToken ) - 1 : -1;
+                Vec_IntPush( vMap, iFlop );
+                nUnmapped += (iFlop == -1);
+            }
+            continue;
+        }
+        if ( pToken[0] == '.' )
+            continue;
+        if ( vMap == NULL )
+        {
+            if ( nIns != nRegs )
+            {
+                Abc_Print( 1, "The invariant has %d variables while the design has %d flops, and there are no names to match them.\n", nIns, nRegs );
+                Vec_IntFreeP( &vRes );
+                break;
+            }
+            vMap = Vec_IntStartNatural( nRegs );
+        }
+        if ( (int)strlen(pToken) != Vec_IntSize(vMap) )
+        {
+            Abc_Print( 1, "The cube \"%s\" has %d literals instead of %d.\n", pToken, (int)strlen(pToken), Vec_IntSize(vMap) );
+            Vec_IntFreeP( &vRes );
+            break;
+        }
+        nCubes++;
+        // make sure all flops of this cube are present
+        for ( i = 0; pToken[i]; i++ )
+            if ( pToken[i] != '-' && Vec_IntEntry(vMap, i) == -1 )
+                break;
+        if ( pToken[i] )
+        {
+            nDropped++;
+            continue;
+        }
+        Vec_IntAddToEntry( vRes, 0, 1 );
+        iSize = Vec_IntSize( vRes );
+        Vec_IntPush( vRes, 0 );
+        for ( i = 0; pToken[i]; i++ )
+            if ( pToken[i] != '-' )
+            {
+                Vec_IntAddToEntry( vRes, iSize, 1 );
+                Vec_IntPush( vRes, Abc_Var2Lit(Vec_IntEntry(vMap, i), pToken[i] == '0') );
+            }
+    }
+    ABC_FREE( pContents );
+    Abc_NamStop( pNames );
+    Vec_IntFreeP( &vMap );
+    if ( vRes == NULL )
+        return NULL;
+    Vec_IntPush( vRes, nRegs );
+    if ( fVerbose )
+        Abc_Print( 1, "Read %d clauses from file \"%s\". Unknown flops = %d. Dropped clauses = %d.\n", nCubes, pFileName, nUnmapped, nDropped );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the largest inductive subset of the clauses.]
+
+  Description [The clauses violated by the initial state (all-0) are
+  removed first. After that, the clauses that are not inductive relative
+  to the remaining ones are removed, until a fixed point is reached
+  (the Houdini algorithm). When a clause is found to be not inductive,
+  the counter-example to induction is used to remove other clauses that
+  fail under the same assignment, without additional SAT calls. The
+  resulting clauses hold in all reachable states, but they may not be
+  strong enough to prove the property. Returns NULL on timeout.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Pdr_InvInductiveSubset( Gia_Man_t * p, Vec_Int_t * vInv, int nBTLimit, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    int n, i, k, status, nLits, fChange = 1, fFailed = 0, nInit = 0, nRemoved = 0, nCalls = 0;
+    Vec_Int_t * vRes = NULL;
+    // create SAT solver
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
+    sat_solver * pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+    int * pCube, * pCube2, * pList = Vec_IntArray(vInv), nCubes = pList[0];
+    // create variables
+    Vec_Int_t * vLits = Vec_IntAlloc(100);
+    Vec_Bit_t * vRemoved = Vec_BitStart( nCubes );
+    int iFoVarBeg = pCnf->nVars - Gia_ManRegNum(p);
+    int iFiVarBeg = 1 + Gia_ManPoNum(p);
+    int iAuxVarBeg = sat_solver_nvars(pSat);
+    assert( Gia_ManRegNum(p) == Vec_IntEntryLast(vInv) );
+    // allocate auxiliary variables
+    assert( sat_solver_nvars(pSat) == pCnf->nVars );
+    sat_solver_setnvars( pSat, sat_solver_nvars(pSat) + nCubes );
+    // add clauses, except those violated by the initial state
+    Pdr_ForEachCube( pList, pCube, i )
+    {
+        for ( k = 0; k < pCube[0]; k++ )
+            if ( !Abc_LitIsCompl(pCube[k+1]) )
+                break;
+        if ( k == pCube[0] )
+        {
+            Vec_BitWriteEntry( vRemoved, i, 1 );
+            nInit++;
+            continue;
+        }
+        Vec_IntFill( vLits, 1, Abc_Var2Lit(iAuxVarBeg + i, 1) ); // neg aux literal
+        for ( k = 0; k < pCube[0]; k++ )
+            Vec_IntPush( vLits, Abc_Var2Lit(iFoVarBeg + Abc_Lit2Var(pCube[k+1]), !Abc_LitIsCompl(pCube[k+1])) );
+        status = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+        assert( status == 1 );
+    }
+    // remove clauses that are not inductive relative to the remaining ones
+    while ( fChange && !fFailed )
+    {
+        fChange = 0;
+        // collect aux literals for remaining clauses
+        Vec_IntClear( vLits );
+        for ( k = 0; k < nCubes; k++ )
+            if ( !Vec_BitEntry(vRemoved, k) )
+                Vec_IntPush( vLits, Abc_Var2Lit(iAuxVarBeg + k, 0) ); // pos aux literal
+        nLits = Vec_IntSize( vLits );
+        Pdr_ForEachCube( pList, pCube, i )
+        {
+            if ( Vec_BitEntry(vRemoved, i) )
+                continue;
+            // check if the next-state cube is reachable from the remaining clauses
+            Vec_IntShrink( vLits, nLits );
+            for ( k = 0; k < pCube[0]; k++ )
+                Vec_IntPush( vLits, Abc_Var2Lit(iFiVarBeg + Abc_Lit2Var(pCube[k+1]), Abc_LitIsCompl(pCube[k+1])) );
+            status = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), nBTLimit, 0, 0, 0 );
+            nCalls++;
+            if ( status == l_Undef ) // timeout
+            {
+                fFailed = 1;
+                break;
+            }
+            if ( status == l_False ) // unsat -- inductive
+                continue;
+            assert( status == l_True );
+            // remove this clause and other clauses failing in the same next state
+            Pdr_ForEachCube( pList, pCube2, n )
+            {
+                if ( Vec_BitEntry(vRemoved, n) )
+                    continue;
+                for ( k = 0; k < pCube2[0]; k++ )
+                    if ( sat_solver_var_value(pSat, iFiVarBeg + Abc_Lit2Var(pCube2[k+1])) == Abc_LitIsCompl(pCube2[k+1]) )
+                        break;
+                if ( k < pCube2[0] )
+                    continue;
+                Vec_BitWriteEntry( vRemoved, n, 1 );
+                nRemoved++;
+            }
+            assert( Vec_BitEntry(vRemoved, i) );
+            fChange = 1;
+        }
+    }
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Inductive subset: Clauses = %d. Init = %d. Non-inductive = %d. Remaining = %d. SAT calls = %d.  ", 
+            nCubes, nInit, nRemoved, nCubes - nInit - nRemoved, nCalls );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    if ( !fFailed )
+    {
+        vRes = Vec_IntAlloc( 1000 );
+        Vec_IntPush( vRes, nCubes - nInit - nRemoved );
+        Pdr_ForEachCube( pList, pCube, i )
+            if ( !Vec_BitEntry(vRemoved, i) )
+                for ( k = 0; k <= pCube[0]; k++ )
+                    Vec_IntPush( vRes, pCube[k] );
+        Vec_IntPush( vRes, Vec_IntEntryLast(vInv) );
+    }
+    Cnf_DataFree( pCnf );
+    sat_solver_delete( pSat );
+    Vec_BitFree( vRemoved );
+    Vec_IntFree( vLits );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the inductive clauses to the timeframes.]
+
+  Description [The clauses hold in every reachable state. They are added
+  to frame k, from which clause pushing propagates them forward, and to 
+  the solvers of frames 1..k. Returns the number of clauses added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSeedClauses( Pdr_Man_t * p, int k, Vec_Int_t * vInv )
+{
+    Vec_Int_t * vLits, * vPiLits;
+    Pdr_Set_t * pSet;
+    int * pCube, * pList = Vec_IntArray(vInv);
+    int i, j, nAdded = 0;
+    if ( Vec_IntEntryLast(vInv) != Aig_ManRegNum(p->pAig) )
+        return 0;
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    Pdr_ForEachCube( pList, pCube, i )
+    {
+        Vec_IntClear( vLits );
+        for ( j = 0; j < pCube[0]; j++ )
+            Vec_IntPush( vLits, pCube[j+1] );
+        pSet = Pdr_SetCreate( vLits, vPiLits );
+        if ( Pdr_ManCheckContainment(p, k, pSet) )
+        {
+            Pdr_SetDeref( pSet );
+            continue;
+        }
+        Vec_VecPush( p->vClauses, k, pSet );   // consume ref
+        p->nCubes++;
+        for ( j = 1; j <= k; j++ )
+            Pdr_ManSolverAddClause( p, j, pSet );
+        nAdded++;
+    }
+    Vec_IntFree( vLits );
+    Vec_IntFree( vPiLits );
+    return nAdded;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,669 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with shared frame clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: pdrPar.c,v 1.0 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+void Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube ) {}
+int  Pdr_ManShareImport( Pdr_Man_t * p ) { return 0; }
+int  Pdr_ManShareStopped( Pdr_Man_t * p ) { return 0; }
+int * Pdr_ManShareStopFlag( Pdr_Man_t * p ) { return NULL; }
+int  Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    int RetValue, nProcs = pPars->nProcs;
+    pPars->nProcs = 1;
+    RetValue = Pdr_ManSolve( pAig, pPars );
+    pPars->nProcs = nProcs;
+    return RetValue;
+}
+
+#else // pthreads are used
+
+#define PDR_THR_MAX 64
+#define PDR_TRY_MAX  4
+
+struct Pdr_Shr_t_
+{
+    Vec_Ptr_t *     vCubes;    // clauses derived by the threads
+    Vec_Int_t *     vFrames;   // the frame of each clause
+    Vec_Int_t *     vOwners;   // the thread that derived each clause
+    pthread_mutex_t Mutex;     // protects the arrays
+    volatile int    fStop;     // set when one of the threads is done
+    int             iWinner;   // the first thread done
+    int             nImported; // clauses validated and added
+    int             nRejected; // clauses failing validation
+    // multi-output mode
+    int             fInvOnly;  // share only the invariants of proved outputs
+    Aig_Man_t *     pAig;      // user's AIG
+    Pdr_Par_t *     pPars;     // user's parameters
+    Vec_Int_t *     vQueue;    // outputs to be solved
+    Vec_Int_t *     vSlices;   // runtime limit of each output, in milliseconds
+    Vec_Int_t *     vTries;    // the number of attempts for each output
+    Vec_Ptr_t *     vCexes;    // counter-examples of the failed outputs
+    int             iQueue;    // the next output to solve
+    int             nResched;  // the number of outputs rescheduled
+    abctime         timeToStop;// global runtime limit
+};
+
+typedef struct Pdr_ThData_t_
+{
+    Aig_Man_t *     pAig;      // copy of the user's AIG
+    Pdr_Par_t       Pars;      // diversified parameters
+    Pdr_Man_t *     pMan;      // PDR manager of this thread
+    Pdr_Shr_t *     pShare;    // shared clauses
+    int             iThread;   // thread number
+    int             RetValue;  // result
+} Pdr_ThData_t;
+
+extern int Pdr_ManSolveInt( Pdr_Man_t * p );
+extern int Pdr_ManFindInvariantStart( Pdr_Man_t * p );
+extern Vec_Ptr_t * Pdr_ManCollectCubes( Pdr_Man_t * p, int kStart );
+extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
+extern int Gia_ManToBridgeAbort( FILE * pFile, int Size, unsigned char * pBuffer );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the clause added in frame k.]
+
+  Description [The shared copy is never referenced by the other threads.
+  They make their own copies while holding the lock.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Shr_t * pShr = p->pShare;
+    if ( pShr->fInvOnly )
+        return;
+    pthread_mutex_lock( &pShr->Mutex );
+    Vec_PtrPush( pShr->vCubes, Pdr_SetDup(pCube) );
+    Vec_IntPush( pShr->vFrames, k );
+    Vec_IntPush( pShr->vOwners, p->iShareId );
+    pthread_mutex_unlock( &pShr->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses published by the other threads.]
+
+  Description [A clause derived in frame k by another thread holds in
+  that thread's frames, which are different from the frames of this one.
+  Before adding it to frames 1..k, it is checked to be inductive relative
+  to frame k-1 of this thread, the same way as a freshly generalized cube.
+  The clauses of an inductive invariant (frame -1) hold in every frame
+  and are added to the last one without checking. Clauses subsumed by
+  those already present are skipped. Returns the number of clauses added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareImport( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShr = p->pShare;
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vFrames;
+    Pdr_Set_t * pCube;
+    int i, j, k, RetValue = 1, nAdded = 0, nRejected = 0;
+    int kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( kMax < 1 )
+        return 0;
+    vCubes  = Vec_PtrAlloc( 100 );
+    vFrames = Vec_IntAlloc( 100 );
+    pthread_mutex_lock( &pShr->Mutex );
+    for ( i = p->iShareNext; i < Vec_PtrSize(pShr->vCubes); i++ )
+    {
+        if ( Vec_IntEntry(pShr->vOwners, i) == p->iShareId )
+            continue;
+        Vec_PtrPush( vCubes, Pdr_SetDup((Pdr_Set_t *)Vec_PtrEntry(pShr->vCubes, i)) );
+        Vec_IntPush( vFrames, Vec_IntEntry(pShr->vFrames, i) );
+    }
+    p->iShareNext = i;
+    pthread_mutex_unlock( &pShr->Mutex );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        k = Vec_IntEntry(vFrames, i) == -1 ? kMax : Abc_MinInt( Vec_IntEntry(vFrames, i), kMax );
+        if ( RetValue == -1 || Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, k, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        if ( Vec_IntEntry(vFrames, i) != -1 )
+            RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, 0, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            nRejected += (RetValue == 0);
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        p->nCubes++;
+        for ( j = 1; j <= k; j++ )
+            Pdr_ManSolverAddClause( p, j, pCube );
+        nAdded++;
+    }
+    Vec_PtrFree( vCubes );
+    Vec_IntFree( vFrames );
+    pthread_mutex_lock( &pShr->Mutex );
+    pShr->nImported += nAdded;
+    pShr->nRejected += nRejected;
+    pthread_mutex_unlock( &pShr->Mutex );
+    return nAdded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Termination check of the threads.]
+
+  Description [Returns 1 if another thread is done or if the time slice
+  of the output solved by this manager (p->timeToStopOne) is over.
+  The SAT solvers of the manager poll the stop flag directly.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareStopped( Pdr_Man_t * p )
+{
+    if ( p->pShare->fStop )
+        return 1;
+    return p->timeToStopOne && Abc_Clock() > p->timeToStopOne;
+}
+int * Pdr_ManShareStopFlag( Pdr_Man_t * p )
+{
+    return (int *)&p->pShare->fStop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the shared clauses.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareStart( Pdr_Shr_t * pShr, Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    int status;
+    memset( pShr, 0, sizeof(Pdr_Shr_t) );
+    pShr->vCubes    = Vec_PtrAlloc( 1000 );
+    pShr->vFrames   = Vec_IntAlloc( 1000 );
+    pShr->vOwners   = Vec_IntAlloc( 1000 );
+    pShr->iWinner   = -1;
+    pShr->pAig      = pAig;
+    pShr->pPars     = pPars;
+    status = pthread_mutex_init( &pShr->Mutex, NULL );  assert( status == 0 );
+}
+void Pdr_ManShareStop( Pdr_Shr_t * pShr )
+{
+    Pdr_Set_t * pCube;
+    int i;
+    Vec_PtrForEachEntry( Pdr_Set_t *, pShr->vCubes, pCube, i )
+        Pdr_SetDeref( pCube );
+    Vec_PtrFree( pShr->vCubes );
+    Vec_IntFree( pShr->vFrames );
+    Vec_IntFree( pShr->vOwners );
+    Vec_IntFreeP( &pShr->vQueue );
+    Vec_IntFreeP( &pShr->vSlices );
+    Vec_IntFreeP( &pShr->vTries );
+    pthread_mutex_destroy( &pShr->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the parameters of one thread.]
+
+  Description [The threads use different SAT solver seeds and
+  generalization settings. They report nothing; the main thread does.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManThreadParams( Pdr_Par_t * pPars, Pdr_Par_t * pParsUser, int iThread )
+{
+    *pPars = *pParsUser;
+    pPars->nRandomSeed  = pParsUser->nRandomSeed + 7919 * iThread;
+    pPars->fFlopOrder  ^= (iThread & 1);
+    pPars->fTwoRounds  ^= ((iThread >> 1) & 1);
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+    pPars->fUseBridge   = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one PDR manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManWorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    Pdr_Shr_t * pShr = pThData->pShare;
+    pThData->pMan = Pdr_ManStart( pThData->pAig, &pThData->Pars, NULL );
+    pThData->pMan->pShare   = pShr;
+    pThData->pMan->iShareId = pThData->iThread;
+    pThData->RetValue = Pdr_ManSolveInt( pThData->pMan );
+    if ( pThData->RetValue != -1 )
+    {
+        pthread_mutex_lock( &pShr->Mutex );
+        if ( pShr->iWinner == -1 )
+            pShr->iWinner = pThData->iThread;
+        pShr->fStop = 1;
+        pthread_mutex_unlock( &pShr->Mutex );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the result of one output in the multi-output mode.]
+
+  Description [Called while holding the lock. The clauses of the
+  invariant of a proved output are published for the other outputs.
+  An output that ran out of its time slice is put back at the end of
+  the queue with a twice larger slice.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManParRecord( Pdr_Shr_t * pShr, Pdr_Man_t * p, int iOut, int RetValue )
+{
+    Pdr_Par_t * pPars = pShr->pPars;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pShr->pAig) );
+    pPars->iFrame = Abc_MaxInt( pPars->iFrame, p->pPars->iFrame );
+    if ( RetValue == 1 )
+    {
+        Vec_Ptr_t * vInv = Pdr_ManCollectCubes( p, Pdr_ManFindInvariantStart(p) );
+        Pdr_Set_t * pCube;
+        int i;
+        Vec_PtrForEachEntry( Pdr_Set_t *, vInv, pCube, i )
+        {
+            Vec_PtrPush( pShr->vCubes, Pdr_SetDup(pCube) );
+            Vec_IntPush( pShr->vFrames, -1 );
+            Vec_IntPush( pShr->vOwners, iOut );
+        }
+        Vec_PtrFree( vInv );
+        Vec_IntWriteEntry( pPars->vOutMap, iOut, 1 );
+        pPars->nProveOuts++;
+        if ( pPars->fUseBridge )
+            Gia_ManToBridgeResult( stdout, 1, NULL, iOut );
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Output %*d was proved in frame %2d (solved %*d out of %*d outputs).\n",
+                nOutDigits, iOut, p->pPars->iFrame, nOutDigits, pPars->nProveOuts + pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pShr->pAig) );
+        return;
+    }
+    if ( RetValue == 0 )
+    {
+        Abc_Cex_t * pCex = p->pAig->pSeqModel;
+        p->pAig->pSeqModel = NULL;
+        assert( pCex != NULL );
+        pCex->iPo = iOut;
+        Vec_IntWriteEntry( pPars->vOutMap, iOut, 0 );
+        pPars->nFailOuts++;
+        if ( pPars->fUseBridge )
+            Gia_ManToBridgeResult( stdout, 0, pCex, iOut );
+        if ( !pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",
+                nOutDigits, iOut, pCex->iFrame, nOutDigits, pPars->nProveOuts + pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pShr->pAig) );
+        if ( !pPars->fUseBridge && !pPars->fStoreCex )
+            Abc_CexFree( pCex ), pCex = (Abc_Cex_t *)(ABC_PTRINT_T)1;
+        Vec_PtrWriteEntry( pShr->vCexes, iOut, pCex );
+        if ( pPars->pFuncOnFail && pPars->pFuncOnFail(iOut, pPars->fStoreCex ? pCex : NULL) )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Quitting due to callback on fail.\n" );
+            pShr->fStop = 1;
+        }
+        return;
+    }
+    if ( pShr->fStop )
+        return;
+    // check if the output ran out of its time slice
+    if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne && (pShr->timeToStop == 0 || Abc_Clock() < pShr->timeToStop) )
+    {
+        Vec_IntAddToEntry( pShr->vTries, iOut, 1 );
+        if ( Vec_IntEntry(pShr->vTries, iOut) < PDR_TRY_MAX )
+        {
+            Vec_IntWriteEntry( pShr->vSlices, iOut, 2 * Vec_IntEntry(pShr->vSlices, iOut) );
+            Vec_IntPush( pShr->vQueue, iOut );
+            pShr->nResched++;
+            return;
+        }
+    }
+    Vec_IntWriteEntry( pPars->vOutMap, iOut, -1 );
+    pPars->nDropOuts++;
+    if ( !pPars->fNotVerbose )
+        Abc_Print( 1, "Timing out on output %*d in frame %d.\n", nOutDigits, iOut, p->pPars->iFrame );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs taken from the queue.]
+
+  Description [Each output is solved by a separate PDR manager working
+  on a copy of the AIG with this output and all flops, so that the flop
+  numbering, and hence the invariant clauses, are the same for all.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManWorkerThreadAll( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    Pdr_Shr_t * pShr = pThData->pShare;
+    Pdr_Par_t Pars;
+    Pdr_Man_t * p;
+    Aig_Man_t * pAig;
+    abctime Deadline;
+    int iOut, nSlice, RetValue;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pShr->Mutex );
+        if ( pShr->timeToStop && Abc_Clock() > pShr->timeToStop )
+            pShr->fStop = 1;
+        if ( pShr->fStop || pShr->iQueue == Vec_IntSize(pShr->vQueue) )
+        {
+            pthread_mutex_unlock( &pShr->Mutex );
+            break;
+        }
+        iOut   = Vec_IntEntry( pShr->vQueue, pShr->iQueue++ );
+        nSlice = Vec_IntEntry( pShr->vSlices, iOut );
+        pAig = Aig_ManDupOneOutput( pShr->pAig, iOut, 1 );
+        pthread_mutex_unlock( &pShr->Mutex );
+        // PDR expects the objects to be numbered without gaps
+        pThData->pAig = Aig_ManDupSimple( pAig );
+        Aig_ManStop( pAig );
+        // set the runtime limit
+        Deadline = nSlice ? Abc_Clock() + (abctime)nSlice * CLOCKS_PER_SEC / 1000 : 0;
+        if ( pShr->timeToStop && (Deadline == 0 || Deadline > pShr->timeToStop) )
+            Deadline = pShr->timeToStop;
+        // solve the output
+        Pars = pThData->Pars;
+        p = Pdr_ManStart( pThData->pAig, &Pars, NULL );
+        p->pShare   = pShr;
+        p->iShareId = iOut;
+        p->timeToStopOne = Deadline;
+        RetValue = Pdr_ManSolveInt( p );
+        pthread_mutex_lock( &pShr->Mutex );
+        Pdr_ManParRecord( pShr, p, iOut, RetValue );
+        pthread_mutex_unlock( &pShr->Mutex );
+        Pdr_ManStop( p );
+        Aig_ManStop( pThData->pAig );
+        pThData->pAig = NULL;
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves all outputs using a pool of PDR threads.]
+
+  Description [The threads take the outputs from a shared queue. When
+  an output is proved, the clauses of its inductive invariant strengthen
+  the frames of the outputs solved after that. With the per-output runtime
+  limit (pPars->nTimeOutOne), an output that timed out is tried again
+  later, up to PDR_TRY_MAX times, doubling the limit each time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolveParAll( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ThData_t ThData[PDR_THR_MAX];
+    pthread_t WorkerThread[PDR_THR_MAX];
+    Pdr_Shr_t Share, * pShr = &Share;
+    Aig_Obj_t * pObj;
+    int i, status, nPos = Saig_ManPoNum(pAig), nProcs = Abc_MinInt( pPars->nProcs, PDR_THR_MAX );
+    abctime clk = Abc_Clock();
+    Pdr_ManShareStart( pShr, pAig, pPars );
+    pShr->fInvOnly   = 1;
+    pShr->vQueue     = Vec_IntAlloc( nPos );
+    pShr->vSlices    = Vec_IntStart( nPos );
+    pShr->vTries     = Vec_IntStart( nPos );
+    pShr->vCexes     = Vec_PtrStart( nPos );
+    pShr->timeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
+    pPars->vOutMap   = Vec_IntAlloc( nPos );
+    Vec_IntFill( pPars->vOutMap, nPos, -2 );
+    Saig_ManForEachPo( pAig, pObj, i )
+    {
+        Vec_IntWriteEntry( pShr->vSlices, i, pPars->nTimeOutOne );
+        if ( Aig_ObjChild0(pObj) != Aig_ManConst0(pAig) )
+        {
+            Vec_IntPush( pShr->vQueue, i );
+            continue;
+        }
+        Vec_IntWriteEntry( pPars->vOutMap, i, 1 ); // unsat
+        pPars->nProveOuts++;
+        if ( pPars->fUseBridge )
+            Gia_ManToBridgeResult( stdout, 1, NULL, i );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pAig     = NULL;
+        ThData[i].pMan     = NULL;
+        ThData[i].pShare   = pShr;
+        ThData[i].iThread  = i;
+        ThData[i].RetValue = -1;
+        Pdr_ManThreadParams( &ThData[i].Pars, pPars, i );
+        ThData[i].Pars.fSolveAll   = 0;
+        ThData[i].Pars.nTimeOut    = 0;
+        ThData[i].Pars.nTimeOutOne = 0;
+        ThData[i].Pars.nTimeOutGap = 0;
+        ThData[i].Pars.vOutMap     = NULL;
+        ThData[i].Pars.pFuncOnFail = NULL;
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManWorkerThreadAll, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    // outputs not solved are undecided
+    for ( i = 0; i < nPos; i++ )
+        if ( Vec_IntEntry(pPars->vOutMap, i) == -2 )
+            Vec_IntWriteEntry( pPars->vOutMap, i, -1 );
+    pPars->nDropOuts = nPos - pPars->nProveOuts - pPars->nFailOuts;
+    if ( pPars->fVerbose )
+    {
+        printf( "Threads = %d.  Outputs:  Proved = %d  Disproved = %d  Undecided = %d  Rescheduled = %d.  ",
+            nProcs, pPars->nProveOuts, pPars->nFailOuts, pPars->nDropOuts, pShr->nResched );
+        printf( "Invariant clauses:  Shared = %d  Imported = %d.  ", Vec_PtrSize(pShr->vCubes), pShr->nImported );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    assert( pAig->vSeqModelVec == NULL );
+    pAig->vSeqModelVec = pShr->vCexes;
+    Pdr_ManShareStop( pShr );
+    pPars->iFrame--;
+    if ( pPars->fUseBridge && pPars->nDropOuts > 0 )
+        Gia_ManToBridgeAbort( stdout, 7, (unsigned char *)"timeout" );
+    if ( pPars->nProveOuts == nPos )
+        return 1;
+    return pPars->nFailOuts ? 0 : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the property using several PDR threads.]
+
+  Description [Each thread runs its own PDR manager on a copy of the AIG,
+  with a different SAT solver seed and generalization settings. The clauses
+  derived by one thread are offered to the others, which add them after
+  checking them relative to their own frames. The first thread to prove
+  or disprove the property stops the others. With pPars->fSolveAll, the
+  threads solve different outputs instead.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ThData_t ThData[PDR_THR_MAX];
+    pthread_t WorkerThread[PDR_THR_MAX];
+    Pdr_Shr_t Share, * pShr = &Share;
+    Pdr_Man_t * p = NULL;
+    int i, status, RetValue = -1, nProcs = Abc_MinInt( pPars->nProcs, PDR_THR_MAX );
+    abctime clk = Abc_Clock();
+    assert( !pPars->fUseAbs );
+    if ( pPars->fSolveAll )
+        return Pdr_ManSolveParAll( pAig, pPars );
+    Pdr_ManShareStart( pShr, pAig, pPars );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pAig     = Aig_ManDupSimple( pAig );
+        ThData[i].pMan     = NULL;
+        ThData[i].pShare   = pShr;
+        ThData[i].iThread  = i;
+        ThData[i].RetValue = -1;
+        Pdr_ManThreadParams( &ThData[i].Pars, pPars, i );
+        // the first thread reports the progress
+        ThData[i].Pars.fSilent = i ? 1 : pPars->fSilent;
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    // detach the managers, so that the solvers created below ignore the stop flag
+    for ( i = 0; i < nProcs; i++ )
+        if ( ThData[i].pMan )
+            ThData[i].pMan->pShare = NULL;
+    // collect the result
+    if ( pShr->iWinner >= 0 )
+    {
+        Pdr_ThData_t * pWin = ThData + pShr->iWinner;
+        p = pWin->pMan;
+        RetValue = pWin->RetValue;
+        pPars->iFrame = pWin->Pars.iFrame;
+        if ( RetValue == 0 )
+        {
+            assert( p->pAig->pSeqModel != NULL );
+            pAig->pSeqModel = p->pAig->pSeqModel;
+            p->pAig->pSeqModel = NULL;
+        }
+        if ( RetValue == 1 && pShr->iWinner > 0 && !pPars->fSilent )
+        {
+            Pdr_ManReportInvariant( p );
+            Pdr_ManVerifyInvariant( p );
+        }
+    }
+    else
+    {
+        for ( i = 0; i < nProcs; i++ )
+            pPars->iFrame = Abc_MaxInt( pPars->iFrame, ThData[i].Pars.iFrame );
+    }
+    if ( p && pPars->fDumpInv )
+    {
+        char * pFileName = pPars->pInvFileName ? pPars->pInvFileName : Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+        Pdr_ManDumpClauses( p, pFileName, RetValue==1 );
+        printf( "Dumped inductive invariant in file \"%s\".\n", pFileName );
+    }
+    else if ( RetValue == 1 )
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+    if ( pPars->fVerbose )
+    {
+        printf( "Threads = %d.  Winner = %d.  Clauses:  Shared = %d  Imported = %d  Rejected = %d.  ",
+            nProcs, pShr->iWinner, Vec_PtrSize(pShr->vCubes), pShr->nImported, pShr->nRejected );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        if ( ThData[i].pMan )
+            Pdr_ManStop( ThData[i].pMan );
+        Aig_ManStop( ThData[i].pAig );
+    }
+    Pdr_ManShareStop( pShr );
+    pPars->iFrame--;
+    // the workers do not use the bridge, so the result of the winner is sent here
+    if ( pPars->fUseBridge )
+    {
+        if ( RetValue == 1 )
+            for ( i = 0; i < Saig_ManPoNum(pAig); i++ )
+                Gia_ManToBridgeResult( stdout, 1, NULL, i );
+        else if ( RetValue == 0 )
+            Gia_ManToBridgeResult( stdout, 0, pAig->pSeqModel, pAig->pSeqModel->iPo );
+        else
+            Gia_ManToBridgeAbort( stdout, 7, (unsigned char *)"timeout" );
+    }
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
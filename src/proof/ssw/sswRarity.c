@@ -23,6 +23,17 @@
 #include "base/main/main.h"
 #include "sat/bmc/bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -56,6 +67,8 @@ struct Ssw_RarMan_t_
     int            iFailPat;     // failed pattern
     // counter-examples
     Vec_Ptr_t *    vCexes;
+    // threads
+    void *         pPar;         // threads simulating ranges of words
 };
 
 
@@ -110,6 +123,7 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
     p->nRandSeed     =   0;
     p->TimeOut       =   0;
     p->TimeOutGap    =   0;
+    p->nProcs        =   1;
     p->fSolveAll     =   0;
     p->fDropSatOuts  =   0;
     p->fSetLastState =   0;
@@ -637,6 +651,175 @@ int Ssw_RarManCheckNonConstOutputs( Ssw_RarMan_t * p, int iFrame, abctime Time )
         return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates internal nodes and COs for a range of words.]
+
+  Description [The loops are specialized for the complemented attributes
+  of the fanins, so that they can be vectorized by the compiler.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_RarManSimulateWords( Ssw_RarMan_t * p, int wStart, int wStop )
+{
+    Aig_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1;
+    int w, i;
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
+        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
+        pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
+        if ( Aig_ObjFaninC0(pObj) && Aig_ObjFaninC1(pObj) )
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = ~(pSim0[w] | pSim1[w]);
+        else if ( Aig_ObjFaninC0(pObj) )
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = ~pSim0[w] & pSim1[w];
+        else if ( Aig_ObjFaninC1(pObj) )
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = pSim0[w] & ~pSim1[w];
+        else
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = pSim0[w] & pSim1[w];
+    }
+    Aig_ManForEachCo( p->pAig, pObj, i )
+    {
+        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
+        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
+        if ( Aig_ObjFaninC0(pObj) )
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = ~pSim0[w];
+        else
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = pSim0[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the words of one frame using several threads.]
+
+  Description [The patterns in different words are independent, so each
+  thread simulates its own range of words, while the main thread assigns
+  the inputs, checks the outputs and updates the rarity table, exactly as
+  in the serial case.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Ssw_RarManStartThreads( Ssw_RarMan_t * p ) {}
+void Ssw_RarManStopThreads( Ssw_RarMan_t * p )  {}
+void Ssw_RarManSimulateThreads( Ssw_RarMan_t * p )
+{
+    Ssw_RarManSimulateWords( p, 0, p->pPars->nWords );
+}
+
+#else // pthreads are used
+
+#define SSW_RAR_THR_MAX 100
+
+typedef struct Ssw_RarThData_t_ Ssw_RarThData_t;
+struct Ssw_RarThData_t_
+{
+    Ssw_RarMan_t *   p;              // the manager (NULL to stop)
+    int              wStart;         // the first word
+    int              wStop;          // the last word plus one
+    volatile int     fWorking;       // the thread is busy
+};
+typedef struct Ssw_RarPar_t_ Ssw_RarPar_t;
+struct Ssw_RarPar_t_
+{
+    int              nProcs;         // the number of ranges (main thread takes the first one)
+    Ssw_RarThData_t  ThData[SSW_RAR_THR_MAX];
+    pthread_t        WorkerThread[SSW_RAR_THR_MAX];
+};
+
+void * Ssw_RarWorkerThread( void * pArg )
+{
+    Ssw_RarThData_t * pThData = (Ssw_RarThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->p == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Ssw_RarManSimulateWords( pThData->p, pThData->wStart, pThData->wStop );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void Ssw_RarManStartThreads( Ssw_RarMan_t * p )
+{
+    Ssw_RarPar_t * pPar;
+    int i, status, nWords = p->pPars->nWords;
+    int nProcs = Abc_MinInt( Abc_MinInt(p->pPars->nProcs, SSW_RAR_THR_MAX), nWords );
+    if ( nProcs < 2 )
+        return;
+    pPar = ABC_CALLOC( Ssw_RarPar_t, 1 );
+    pPar->nProcs = nProcs;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Ssw_RarThData_t * pTh = pPar->ThData + i;
+        pTh->p        = p;
+        pTh->wStart   = i * nWords / nProcs;
+        pTh->wStop    = (i + 1) * nWords / nProcs;
+        pTh->fWorking = 0;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( pPar->WorkerThread + i, NULL, Ssw_RarWorkerThread, (void *)pTh );  assert( status == 0 );
+    }
+    p->pPar = pPar;
+}
+void Ssw_RarManStopThreads( Ssw_RarMan_t * p )
+{
+    Ssw_RarPar_t * pPar = (Ssw_RarPar_t *)p->pPar;
+    int i;
+    if ( pPar == NULL )
+        return;
+    for ( i = 1; i < pPar->nProcs; i++ )
+    {
+        assert( !pPar->ThData[i].fWorking );
+        pPar->ThData[i].p = NULL;
+        pPar->ThData[i].fWorking = 1;
+    }
+    for ( i = 1; i < pPar->nProcs; i++ )
+        pthread_join( pPar->WorkerThread[i], NULL );
+    ABC_FREE( p->pPar );
+}
+void Ssw_RarManSimulateThreads( Ssw_RarMan_t * p )
+{
+    Ssw_RarPar_t * pPar = (Ssw_RarPar_t *)p->pPar;
+    int i;
+    if ( pPar == NULL )
+    {
+        Ssw_RarManSimulateWords( p, 0, p->pPars->nWords );
+        return;
+    }
+    for ( i = 1; i < pPar->nProcs; i++ )
+        pPar->ThData[i].fWorking = 1;
+    Ssw_RarManSimulateWords( p, pPar->ThData[0].wStart, pPar->ThData[0].wStop );
+    // wait till threads finish
+    for ( i = 1; i < pPar->nProcs; i++ )
+        if ( pPar->ThData[i].fWorking )
+            i = 0;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs one round of simulation.]
@@ -659,6 +842,12 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
     Vec_PtrClear( p->vUpdConst );
     Vec_PtrClear( p->vUpdClass );
     Aig_ManIncrementTravId( p->pAig );
+    // simulate without refining classes
+    if ( !fUpdate )
+    {
+        Ssw_RarManSimulateThreads( p );
+        return;
+    }
     // check comb inputs
     if ( fUpdate )
     Aig_ManForEachCi( p->pAig, pObj, i )
@@ -1001,6 +1190,9 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
     // create manager
     p = Ssw_RarManStart( pAig, pPars );
     p->vInits = Vec_IntStart( Aig_ManRegNum(pAig) * pPars->nWords );
+    Ssw_RarManStartThreads( p );
+    if ( pPars->fVerbose && p->pPar )
+        Abc_Print( 1, "Simulating words using %d threads.\n", Abc_MinInt(pPars->nProcs, pPars->nWords) );
 
     // perform simulation rounds
     pPars->nSolved = 0;
@@ -1133,6 +1325,7 @@ finish:
         }
     }
     // cleanup
+    Ssw_RarManStopThreads( p );
     Ssw_RarManStop( p );
     return RetValue;
 }
@@ -105,6 +105,7 @@ struct Saig_ParBmc_t_
     int         nTimeOutGap;    // approximate timeout in seconds since the last change
     int         nTimeOutOne;    // timeout per output in multi-output solving
     int         nPisAbstract;   // the number of PIs to abstract
+    int         nFramesWin;     // the number of timeframes kept in the solver (0 = all)
     int         fSolveAll;      // does not stop at the first SAT output
     int         fStoreCex;      // enable storing CEXes in the MO mode
     int         fUseBridge;     // use bridge interface
@@ -147,6 +148,7 @@ struct Bmc_AndPar_t_
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    int         fShareCls;      // share learned clauses among parallel solvers
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
@@ -204,6 +206,11 @@ struct Bmc_ParFf_t_
     int        fVerbose;
 };
 
+// portfolio of concurrent SAT solvers (bmcPort.c)
+typedef struct Bmc_Port_t_ Bmc_Port_t;
+// lock-free pool of learned clauses shared by threads (bmcPort.c)
+typedef struct Bmc_Shr_t_ Bmc_Shr_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -215,7 +222,7 @@ struct Bmc_ParFf_t_
 /*=== bmcBCore.c ==========================================================*/
 extern void              Bmc_ManBCorePerform( Gia_Man_t * pGia, Bmc_BCorePar_t * pPars );
 /*=== bmcBmc.c ==========================================================*/
-extern int               Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nBTLimit, int fRewrite, int fVerbose, int * piFrame, int nCofFanLit, int fUseSatoko );
+extern int               Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nBTLimit, int fRewrite, int fVerbose, int * piFrame, int nCofFanLit, int fUseSatoko, int nProcs );
 /*=== bmcBmc2.c ==========================================================*/
 extern int               Saig_BmcPerform( Aig_Man_t * pAig, int nStart, int nFramesMax, int nNodesMax, int nTimeOut, int nConfMaxOne, int nConfMaxAll, int fVerbose, int fVerbOverwrite, int * piFrames, int fSilent, int fUseSatoko );
 /*=== bmcBmc3.c ==========================================================*/
@@ -241,6 +248,25 @@ extern int               Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcPort.c ==========================================================*/
+extern Bmc_Shr_t *       Bmc_ShrAlloc( int nThreads, int nSizeMax, int nLbdMax );
+extern void              Bmc_ShrFree( Bmc_Shr_t * p );
+extern void              Bmc_ShrPrintStats( Bmc_Shr_t * p );
+extern void              Bmc_ShrExport( void * pShr, int iThread, int * pLits, int nLits, int Lbd );
+extern int *             Bmc_ShrImport( void * pShr, int iThread, int * pnLits );
+extern Bmc_Port_t *      Bmc_PortStart( int nEngines, int fShare, int fVerbose );
+extern void              Bmc_PortStop( Bmc_Port_t * p );
+extern int               Bmc_PortAddVar( Bmc_Port_t * p );
+extern void              Bmc_PortSetNVars( Bmc_Port_t * p, int nVars );
+extern int               Bmc_PortVarNum( Bmc_Port_t * p );
+extern int               Bmc_PortAddClause( Bmc_Port_t * p, int * pLits, int nLits );
+extern void              Bmc_PortSetConflictLimit( Bmc_Port_t * p, int nConfLimit );
+extern void              Bmc_PortSetRuntimeLimit( Bmc_Port_t * p, abctime nRuntimeLimit );
+extern int               Bmc_PortSolve( Bmc_Port_t * p, int * pLits, int nLits );
+extern int               Bmc_PortWinner( Bmc_Port_t * p );
+extern int               Bmc_PortVarValue( Bmc_Port_t * p, int iVar );
+extern int               Bmc_PortFinal( Bmc_Port_t * p, int ** ppArray );
+extern void              Bmc_PortPrintStats( Bmc_Port_t * p );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
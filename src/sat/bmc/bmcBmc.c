@@ -192,23 +192,34 @@ int * Sat2_SolverGetModel( satoko_t * p, int * pVars, int nVars )
         pModel[i] = satoko_read_cex_varvalue(p, pVars[i]);
     return pModel;    
 }
+int * Bmc_PortGetModel( Bmc_Port_t * p, int * pVars, int nVars )
+{
+    int * pModel;
+    int i;
+    pModel = ABC_CALLOC( int, nVars+1 );
+    for ( i = 0; i < nVars; i++ )
+        pModel[i] = Bmc_PortVarValue(p, pVars[i]);
+    return pModel;    
+}
  
 /**Function*************************************************************
 
   Synopsis    [Performs BMC for the given AIG.]
 
-  Description []
+  Description [With nProcs > 1, the outputs of the unrolled frames are
+  solved by a portfolio of nProcs concurrent SAT solvers (Bmc_Port_t).]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nConfLimit, int fRewrite, int fVerbose, int * piFrame, int nCofFanLit, int fUseSatoko )
+int Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nConfLimit, int fRewrite, int fVerbose, int * piFrame, int nCofFanLit, int fUseSatoko, int nProcs )
 {
     extern Aig_Man_t * Gia_ManCofactorAig( Aig_Man_t * p, int nFrames, int nCofFanLit );
     sat_solver * pSat = NULL;
     satoko_t * pSat2 = NULL;
+    Bmc_Port_t * pPort = NULL;
     Cnf_Dat_t * pCnf;
     Aig_Man_t * pFrames, * pAigTemp;
     Aig_Obj_t * pObj;
@@ -263,7 +274,15 @@ int Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nConfLim
     pCnf = Cnf_Derive( pFrames, Aig_ManCoNum(pFrames) );  
 //if ( s_fInterrupt )
 //return -1;
-    if ( fUseSatoko )
+    if ( nProcs > 1 )
+    {
+        pPort = Bmc_PortStart( nProcs, 1, fVerbose );
+        Bmc_PortSetNVars( pPort, pCnf->nVars );
+        for ( i = 0; i < pCnf->nClauses; i++ )
+            Bmc_PortAddClause( pPort, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] );
+        Bmc_PortSetConflictLimit( pPort, nConfLimit );
+    }
+    else if ( fUseSatoko )
     {
         satoko_opts_t opts;
         satoko_default_opts(&opts);
@@ -310,7 +329,9 @@ int Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nConfLim
                     i % Saig_ManPoNum(pAig), i / Saig_ManPoNum(pAig) );
             }
             clk = Abc_Clock();
-            if ( pSat2 )
+            if ( pPort )
+                status = Bmc_PortSolve( pPort, &Lit, 1 );
+            else if ( pSat2 )
                 status = satoko_solve_assumptions_limit( pSat2, &Lit, 1, nConfLimit );
             else
                 status = sat_solver_solve( pSat, &Lit, &Lit + 1, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
@@ -318,9 +339,12 @@ int Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nConfLim
             {
                 printf( "Solved %2d outputs of frame %3d.  ", 
                     Saig_ManPoNum(pAig), i / Saig_ManPoNum(pAig) );
-                printf( "Conf =%8.0f. Imp =%11.0f. ", 
-                    (double)(pSat ? pSat->stats.conflicts    : satoko_conflictnum(pSat2)), 
-                    (double)(pSat ? pSat->stats.propagations : satoko_stats(pSat2)->n_propagations) );
+                if ( pPort )
+                    printf( "Winner = %2d. ", Bmc_PortWinner(pPort) );
+                else
+                    printf( "Conf =%8.0f. Imp =%11.0f. ", 
+                        (double)(pSat ? pSat->stats.conflicts    : satoko_conflictnum(pSat2)), 
+                        (double)(pSat ? pSat->stats.propagations : satoko_stats(pSat2)->n_propagations) );
                 ABC_PRT( "T", Abc_Clock() - clkPart );
                 clkPart = Abc_Clock();
                 fflush( stdout );
@@ -341,7 +365,7 @@ int Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nConfLim
             else if ( status == l_True )
             {
                 Vec_Int_t * vCiIds = Cnf_DataCollectPiSatNums( pCnf, pFrames );
-                int * pModel = pSat2 ? Sat2_SolverGetModel(pSat2, vCiIds->pArray, vCiIds->nSize) : Sat_SolverGetModel(pSat, vCiIds->pArray, vCiIds->nSize);
+                int * pModel = pPort ? Bmc_PortGetModel(pPort, vCiIds->pArray, vCiIds->nSize) : pSat2 ? Sat2_SolverGetModel(pSat2, vCiIds->pArray, vCiIds->nSize) : Sat_SolverGetModel(pSat, vCiIds->pArray, vCiIds->nSize);
                 pModel[Aig_ManCiNum(pFrames)] = pObj->Id;
                 pAig->pSeqModel = Fra_SmlCopyCounterExample( pAig, pFrames, pModel );
                 ABC_FREE( pModel );
@@ -363,6 +387,7 @@ int Saig_ManBmcSimple( Aig_Man_t * pAig, int nFrames, int nSizeMax, int nConfLim
     }
     if ( pSat )  sat_solver_delete( pSat );
     if ( pSat2 ) satoko_destroy( pSat2 );
+    if ( pPort ) Bmc_PortStop( pPort );
     Cnf_DataFree( pCnf );
     Aig_ManStop( pFrames );
     return RetValue;
@@ -65,6 +65,9 @@ struct Gia_ManBmc_t_
     satoko_t *        pSat2;       // SAT solver
     bmcg_sat_solver * pSat3;       // SAT solver
     int               nSatVars;    // SAT variables
+    int               iFrameBase;  // the first frame in the SAT solver
+    int               nFramesWin;  // the current window size
+    int               nWinRestarts;// the number of window restarts
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
@@ -811,6 +814,9 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
             100.0*nUsedVars/(p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2)) );
         Abc_Print( 1, "Buffs = %d. Dups = %d.   Hash hits = %d.  Hash misses = %d.  UniProps = %d.\n", 
             p->nBufNum, p->nDupNum, p->nHashHit, p->nHashMiss, p->nUniProps );
+        if ( p->nFramesWin )
+            Abc_Print( 1, "Window = %d frames.  Restarts = %d.  First frame in the solver = %d.\n", 
+                p->nFramesWin, p->nWinRestarts, p->iFrameBase );
     }
 //    Aig_ManCleanMarkA( p->pAig );
     if ( p->vCexes )
@@ -1342,6 +1348,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nTimeOut       =     0;    // approximate timeout in seconds
     p->nTimeOutGap    =     0;    // time since the last CEX found
     p->nPisAbstract   =     0;    // the number of PIs to abstract
+    p->nFramesWin     =     0;    // the number of timeframes kept in the solver
     p->fSolveAll      =     0;    // stops on the first SAT instance
     p->fDropSatOuts   =     0;    // replace sat outputs by constant 0
     p->nLearnedStart  = 10000;    // starting learned clause limit
@@ -1447,6 +1454,166 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Applies the parameters to the current SAT solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcSetupSolver( Gia_ManBmc_t * p, abctime nTimeToStop )
+{
+    if ( p->pSat )
+    {
+        p->pSat->nLearntStart = p->pPars->nLearnedStart;
+        p->pSat->nLearntDelta = p->pPars->nLearnedDelta;
+        p->pSat->nLearntRatio = p->pPars->nLearnedPerce;
+        p->pSat->nLearntMax   = p->pSat->nLearntStart;
+        p->pSat->fNoRestarts  = p->pPars->fNoRestarts;
+        p->pSat->RunId        = p->pPars->RunId;
+        p->pSat->pFuncStop    = p->pPars->pFuncStop;
+    }
+    else if ( p->pSat3 )
+    {
+//        satoko_set_runid(p->pSat3, p->pPars->RunId);
+//        satoko_set_stop_func(p->pSat3, p->pPars->pFuncStop);
+    }
+    else
+    {
+        satoko_set_runid(p->pSat2, p->pPars->RunId);
+        satoko_set_stop_func(p->pSat2, p->pPars->pFuncStop);
+    }
+    if ( nTimeToStop )
+    {
+        if ( p->pSat2 )
+            satoko_set_runtime_limit( p->pSat2, nTimeToStop );
+        else if ( p->pSat3 )
+            bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
+        else
+            sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restarts the unrolling from the given timeframe.]
+
+  Description [Timeframes before iBase are removed from the SAT solver
+  and their variable maps are released. The flop outputs of frame iBase
+  become free variables, except those proved constant by ternary simulation
+  or assigned at the top level of the old solver, which stay constant.
+  The resulting unrolling over-approximates the states reachable in 
+  frame iBase, so the UNSAT results remain valid while the SAT results 
+  should be confirmed by restarting from frame 0.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcWindowRestart( Gia_ManBmc_t * p, int iBase, abctime nTimeToStop )
+{
+    Aig_Obj_t * pObj;
+    Vec_Int_t * vFrame, * vLits;
+    unsigned * pInfo;
+    int i, f, iLit, Value;
+    assert( iBase == 0 || iBase >= p->iFrameBase );
+    assert( iBase < Vec_PtrSize(p->vId2Var) );
+    // collect the flop values in the new base frame
+    vLits = Vec_IntStartFull( Saig_ManRegNum(p->pAig) );
+    if ( iBase > 0 )
+    {
+        pInfo = (unsigned *)Vec_PtrEntry( p->vTerInfo, iBase );
+        Saig_ManForEachLo( p->pAig, pObj, i )
+        {
+            Value = Saig_ManBmcRunTerSim_rec( p, pObj, iBase );
+            if ( Value == SAIG_TER_ZER || Value == SAIG_TER_ONE )
+            {
+                Vec_IntWriteEntry( vLits, i, (int)(Value == SAIG_TER_ONE) );
+                continue;
+            }
+            iLit = Saig_ManBmcLiteral( p, pObj, iBase );
+            if ( iLit == ~0 || iLit < 2 )
+            {
+                Vec_IntWriteEntry( vLits, i, iLit );
+                continue;
+            }
+            if ( p->pSat && Abc_Lit2Var(iLit) < sat_solver_nvars(p->pSat) && (Value = sat_solver_get_var_value(p->pSat, Abc_Lit2Var(iLit))) != l_Undef )
+                Vec_IntWriteEntry( vLits, i, Abc_LitIsCompl(iLit) ^ (Value == l_True) );
+        }
+    }
+    // replace the solver
+    if ( p->pSat2 )
+    {
+        satoko_opts_t opts;
+        satoko_default_opts(&opts);
+        opts.conf_limit = p->pPars->nConfLimit;
+        satoko_destroy( p->pSat2 );
+        p->pSat2 = satoko_create();  
+        satoko_configure(p->pSat2, &opts);
+        satoko_setnvars(p->pSat2, 1000);
+    }
+    else if ( p->pSat3 )
+    {
+        bmcg_sat_solver_stop( p->pSat3 );
+        p->pSat3 = bmcg_sat_solver_start();  
+        for ( i = 0; i < 1000; i++ )
+            bmcg_sat_solver_addvar( p->pSat3 );
+    }
+    else
+    {
+        sat_solver_delete( p->pSat );
+        p->pSat  = sat_solver_new();
+        sat_solver_setnvars(p->pSat, 1000);
+    }
+    Saig_ManBmcSetupSolver( p, nTimeToStop );
+    p->nSatVars = 1;
+    // clean the hash table of cuts
+    Vec_IntClear( p->vData );
+    Vec_IntClear( p->vId2Lit );
+    Hsh_IntManStop( p->vHash );
+    p->vHash = Hsh_IntManStart( p->vData, 5, 10000 );
+    // release the old frames and reset the remaining ones
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vId2Var, vFrame, f )
+    {
+        if ( f < iBase )
+        {
+            Vec_IntErase( vFrame );
+            continue;
+        }
+        Vec_IntFill( vFrame, p->nObjNums, ~0 );
+        Saig_ManBmcSetLiteral( p, Aig_ManConst1(p->pAig), f, 1 );
+        // transfer constants found by ternary simulation
+        pInfo = (unsigned *)Vec_PtrEntry( p->vTerInfo, f );
+        Aig_ManForEachNode( p->pAig, pObj, i )
+        {
+            if ( !Saig_ManBmcMapping(p, pObj) )
+                continue;
+            Value = Saig_ManBmcSimInfoGet( pInfo, pObj );
+            if ( Value == SAIG_TER_ZER || Value == SAIG_TER_ONE )
+                Saig_ManBmcSetLiteral( p, pObj, f, (int)(Value == SAIG_TER_ONE) );
+        }
+    }
+    // assign the flop outputs of the base frame
+    Saig_ManForEachLo( p->pAig, pObj, i )
+    {
+        if ( iBase == 0 )
+            iLit = 0;
+        else if ( Vec_IntEntry(vLits, i) == 0 || Vec_IntEntry(vLits, i) == 1 )
+            iLit = Vec_IntEntry(vLits, i);
+        else
+            iLit = toLit( p->nSatVars++ );
+        Saig_ManBmcSetLiteral( p, pObj, iBase, iLit );
+    }
+    Vec_IntFree( vLits );
+    p->iFrameBase = iBase;
+    p->nWinRestarts++;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1482,26 +1649,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     // create BMC manager
     p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose );
     p->pPars = pPars;
-    if ( p->pSat )
-    {
-        p->pSat->nLearntStart = p->pPars->nLearnedStart;
-        p->pSat->nLearntDelta = p->pPars->nLearnedDelta;
-        p->pSat->nLearntRatio = p->pPars->nLearnedPerce;
-        p->pSat->nLearntMax   = p->pSat->nLearntStart;
-        p->pSat->fNoRestarts  = p->pPars->fNoRestarts;
-        p->pSat->RunId        = p->pPars->RunId;
-        p->pSat->pFuncStop    = p->pPars->pFuncStop;
-    }
-    else if ( p->pSat3 )
-    {
-//        satoko_set_runid(p->pSat3, p->pPars->RunId);
-//        satoko_set_stop_func(p->pSat3, p->pPars->pFuncStop);
-    }
-    else
-    {
-        satoko_set_runid(p->pSat2, p->pPars->RunId);
-        satoko_set_stop_func(p->pSat2, p->pPars->pFuncStop);
-    }
+    p->nFramesWin = pPars->nFramesWin;
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
     if ( pPars->fVerbose )
@@ -1509,20 +1657,12 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n",// Sect =%3d.\n", 
             Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
             Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig), p->nObjNums );//, Vec_VecSize(p->vSects) );
-        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d.\n", 
-            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
+        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d. Window = %d.\n", 
+            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll, pPars->nFramesWin );
     } 
     pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
-    // set runtime limit
-    if ( nTimeToStop )
-    {
-        if ( p->pSat2 )
-            satoko_set_runtime_limit( p->pSat2, nTimeToStop );
-        else if ( p->pSat3 )
-            bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
-        else
-            sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
-    }
+    // set solver parameters and runtime limit
+    Saig_ManBmcSetupSolver( p, nTimeToStop );
     // perform frames
     Aig_ManRandom( 1 );
     pPars->timeLastSolved = Abc_Clock();
@@ -1575,6 +1715,9 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                 Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
             }
         }
+        // slide the window by dropping the older half of the unrolling
+        if ( p->nFramesWin && f - p->iFrameBase >= p->nFramesWin )
+            Saig_ManBmcWindowRestart( p, f - p->nFramesWin / 2, nTimeToStop );
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
         // create CNF upfront
@@ -1658,6 +1801,16 @@ clkOther += Abc_Clock() - clk2;
             }
 clk2 = Abc_Clock();
             status = Saig_ManCallSolver( p, Lit );
+            if ( status == l_True && p->iFrameBase > 0 )
+            {
+                // the window starts in a free state; confirm the CEX from the initial state
+                Saig_ManBmcWindowRestart( p, 0, p->pTime4Outs ? p->pTime4Outs[i] + clkOne : nTimeToStop );
+                Lit = Saig_ManBmcCreateCnf( p, pObj, f );
+                status = Saig_ManCallSolver( p, Lit );
+                // the CEX is spurious; the window is too short to capture the invariants
+                if ( status == l_False )
+                    p->nFramesWin *= 2;
+            }
 clkSatRun = Abc_Clock() - clk2;
             if ( pLogFile )
                 fprintf( pLogFile, "Frame %5d  Output %5d  Time(ms) %8d %8d\n", f, i, 
@@ -1852,7 +2005,7 @@ nTimeUndec += clkSatRun;
                 Abc_Print( 1, "T/O =%4d. ", pPars->nDropOuts );
 //            ABC_PRT( "Time", Abc_Clock() - clk );
 //            Abc_Print( 1, "%4.0f MB",     4.0*Vec_IntSize(p->vVisited) /(1<<20) );
-            Abc_Print( 1, "%4.0f MB",     4.0*(f+1)*p->nObjNums /(1<<20) );
+            Abc_Print( 1, "%4.0f MB",     4.0*(f+1-p->iFrameBase)*p->nObjNums /(1<<20) );
             Abc_Print( 1, "%4.0f MB",     1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
 //            Abc_Print( 1, " %6d %6d ",   p->nLitUsed, p->nLitUseless );
             Abc_Print( 1, "%9.2f sec ",   1.0*(Abc_Clock() - clkTotal)/CLOCKS_PER_SEC );
@@ -77,6 +77,7 @@ struct Bmcs_Man_t_
     Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
     Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
     bmc_sat_solver *  pSats[PAR_THR_MAX];  // concurrent SAT solvers
+    Bmc_Shr_t *       pShr;                // learned clauses shared by the solvers
     int               nSatVars;            // number of SAT variables used
     int               nSatVarsOld;         // number of SAT variables used
     int               fStopNow;            // signal when it is time to stop
@@ -381,6 +382,11 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Vec_IntGrow( &p->vFr2Sat, 3*Gia_ManCiNum(pGia) );  
     Vec_IntPush( &p->vFr2Sat, 0 );
     Vec_IntGrow( &p->vCiMap, 3*Gia_ManCiNum(pGia) );
+#ifndef ABC_USE_EXT_SOLVERS
+    // the solvers load the same unrolling, so their learned clauses are valid for each other
+    if ( pPars->fShareCls && pPars->nProcs > 1 )
+        p->pShr = Bmc_ShrAlloc( pPars->nProcs, 10, 4 );
+#endif
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         // modify parameters to get different SAT solvers
@@ -397,6 +403,11 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         bmc_sat_solver_addvar( p->pSats[i] );
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
         bmc_sat_solver_setstop( p->pSats[i], &p->fStopNow );
+#ifndef ABC_USE_EXT_SOLVERS
+        satoko_set_runid( p->pSats[i], i );
+        if ( p->pShr )
+            satoko_set_share( p->pSats[i], p->pShr, Bmc_ShrExport, Bmc_ShrImport );
+#endif
     }
     p->nSatVars = 1;
     return p;
@@ -413,6 +424,8 @@ void Bmcs_ManStop( Bmcs_Man_t * p )
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmc_sat_solver_stop( p->pSats[i] );
+    if ( p->pShr )
+        Bmc_ShrFree( p->pShr );
     ABC_FREE( p );
 }
 
@@ -899,11 +912,16 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         ThData[i].pSat = NULL;
         ThData[i].fWorking = 1;
     }
+    // wait till threads exit (they read ThData, which lives on this stack)
+    for ( i = 0; i < pPars->nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Bmcs_ManPrintTime( p );
+    if ( p->pShr && pPars->fVerbose )
+        Bmc_ShrPrintStats( p->pShr );
     Bmcs_ManStop( p );
     return RetValue;
 }
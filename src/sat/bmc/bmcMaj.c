@@ -23,6 +23,7 @@
 #include "misc/util/utilTruth.h"
 #include "sat/glucose/AbcGlucose.h"
 #include "aig/miniaig/miniaig.h"
+#include "opt/dau/dau.h"
 #include "base/io/ioResub.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -430,6 +431,8 @@ struct Exa_Man_t_
     int               VarMarks[MAJ_NOBJS][2][MAJ_NOBJS]; // variable marks
     int               VarVals[MAJ_NOBJS]; // values of the first nVars variables
     Vec_Wec_t *       vOutLits;  // output vars
+    Vec_Int_t *       vMintVars; // output var of each minterm (template mode only)
+    Vec_Int_t *       vClauses;  // clauses added so far (template mode only)
     bmcg_sat_solver * pSat;      // SAT solver
     FILE *            pFile;
     int               nCnfClauses;
@@ -482,7 +485,8 @@ int Exa_ManMarkup( Exa_Man_t * p )
             }
         }
     }
-    printf( "The number of parameter variables = %d.\n", p->iVar );
+    if ( p->pTruth ) // not a template
+        printf( "The number of parameter variables = %d.\n", p->iVar );
     return p->iVar;
     // printout
     for ( i = p->nVars; i < p->nObjs; i++ )
@@ -511,7 +515,7 @@ Exa_Man_t * Exa_ManAlloc( Bmc_EsPar_t * pPars, word * pTruth )
     p->vInfo      = Exa_ManTruthTables( p );
     p->pSat       = bmcg_sat_solver_start();
     bmcg_sat_solver_set_nvars( p->pSat, p->iVar );
-    if ( pPars->RuntimeLim )
+    if ( pPars->RuntimeLim && pTruth ) // templates set it for each function
         bmcg_sat_solver_set_runtime_limit( p->pSat, Abc_Clock() + pPars->RuntimeLim * CLOCKS_PER_SEC );
     if ( pPars->fDumpCnf )
     {
@@ -536,6 +540,8 @@ void Exa_ManFree( Exa_Man_t * p )
     bmcg_sat_solver_stop( p->pSat );
     Vec_WrdFree( p->vInfo );
     Vec_WecFree( p->vOutLits );
+    Vec_IntFreeP( &p->vMintVars );
+    Vec_IntFreeP( &p->vClauses );
     ABC_FREE( p );
 }
 
@@ -703,6 +709,11 @@ static inline int Exa_ManAddClause( Exa_Man_t * p, int * pLits, int nLits )
             fprintf( p->pFile, "%s%d ", Abc_LitIsCompl(pLits[i]) ? "-" : "", Abc_Lit2Var(pLits[i]) );
         fprintf( p->pFile, "0\n" );
     }
+    if ( p->vClauses )
+    {
+        Vec_IntPush( p->vClauses, nLits );
+        Vec_IntPushArray( p->vClauses, pLits, nLits );
+    }
     return bmcg_sat_solver_addclause( p->pSat, pLits, nLits );
 }
 int Exa_ManAddCnfAdd( Exa_Man_t * p, int * pnAdded )
@@ -891,10 +902,10 @@ int Exa_ManAddCnf( Exa_Man_t * p, int iMint )
                 }
             }
         }
-        // node functionality
+        // node functionality (in template mode, the output has a variable constrained by assumptions)
         for ( n = 0; n < 2; n++ )
         {
-            if ( i == p->nObjs - 1 && n == Value )
+            if ( i == p->nObjs - 1 && n == Value && !p->vMintVars )
                 continue;
             for ( k = 0; k < 4; k++ )
             {
@@ -903,7 +914,7 @@ int Exa_ManAddCnf( Exa_Man_t * p, int iMint )
                     continue;
                 pLits[nLits++] = Abc_Var2Lit( iBaseSatVarI + 0, (k&1)  );
                 pLits[nLits++] = Abc_Var2Lit( iBaseSatVarI + 1, (k>>1) );
-                if ( i != p->nObjs - 1 ) pLits[nLits++] = Abc_Var2Lit( iBaseSatVarI + 2, !n );
+                if ( i != p->nObjs - 1 || p->vMintVars ) pLits[nLits++] = Abc_Var2Lit( iBaseSatVarI + 2, !n );
                 if ( k > 0 )             pLits[nLits++] = Abc_Var2Lit( iVarStart +  k-1,  n );
                 assert( nLits <= 4 );
                 if ( !Exa_ManAddClause( p, pLits, nLits ) )
@@ -911,6 +922,8 @@ int Exa_ManAddCnf( Exa_Man_t * p, int iMint )
             }
         }
     }
+    if ( p->vMintVars )
+        Vec_IntWriteEntry( p->vMintVars, iMint, p->iVar + 3*(p->nNodes-1) + 2 );
     p->iVar += 3*p->nNodes;
     return 1;
 }
@@ -965,6 +978,206 @@ void Exa_ManExactSynthesis( Bmc_EsPar_t * pPars )
     Abc_PrintTime( 1, "Total runtime", Abc_Clock() - clkTotal );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Encoding template for exact synthesis of many functions.]
+
+  Description [The topology constraints do not depend on the function.
+  The minterm constraints do not depend on it either, if the output node
+  gets a variable for each minterm, similar to the internal nodes.
+  The template records these clauses, so that they are derived once
+  for all functions with the same number of inputs and gates. Minterm
+  constraints are added on demand, when a solution fails on a minterm,
+  and are kept for the following functions. Each function is solved by
+  a new solver loaded with the template, with the function values given
+  as unit clauses on the output variables. (Giving them as assumptions
+  to one solver kept for all functions was twice slower, because the
+  proofs of minimality are dominated by the conflicts, and Glucose
+  treats each assumption as a separate decision level.)]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Exa_Man_t * Exa_ManTemplateAlloc( Bmc_EsPar_t * pPars )
+{
+    Exa_Man_t * p;
+    assert( !pPars->fDynConstr && !pPars->fDumpCnf );
+    p = Exa_ManAlloc( pPars, NULL );
+    p->vMintVars = Vec_IntStartFull( 1 << p->nVars );
+    p->vClauses  = Vec_IntAlloc( 1 << 12 );
+    if ( !Exa_ManAddCnfStart( p, pPars->fOnlyAnd ) )
+    {
+        Exa_ManFree( p );
+        return NULL;
+    }
+    return p;
+}
+static inline int Exa_ManTemplateAddValue( Exa_Man_t * p, int iMint )
+{
+    int Lit = Abc_Var2Lit( Vec_IntEntry(p->vMintVars, iMint), !Abc_TtGetBit(p->pTruth, iMint) );
+    return bmcg_sat_solver_addclause( p->pSat, &Lit, 1 );
+}
+int Exa_ManTemplateSolve( Exa_Man_t * p, word * pTruth )
+{
+    int * pClause, iMint, OutVar, status = GLUCOSE_UNSAT;
+    assert( !(pTruth[0] & 1) );
+    p->pTruth = pTruth;
+    // load the template into a new solver
+    bmcg_sat_solver_stop( p->pSat );
+    p->pSat = bmcg_sat_solver_start();
+    bmcg_sat_solver_set_nvars( p->pSat, p->iVar );
+    if ( p->pPars->RuntimeLim )
+        bmcg_sat_solver_set_runtime_limit( p->pSat, Abc_Clock() + p->pPars->RuntimeLim * CLOCKS_PER_SEC );
+    for ( pClause = Vec_IntArray(p->vClauses); pClause < Vec_IntLimit(p->vClauses); pClause += pClause[0] + 1 )
+        if ( !bmcg_sat_solver_addclause( p->pSat, pClause + 1, pClause[0] ) )
+            return GLUCOSE_UNSAT;
+    // add the function values on the minterms seen so far
+    Vec_IntForEachEntry( p->vMintVars, OutVar, iMint )
+        if ( OutVar >= 0 && !Exa_ManTemplateAddValue(p, iMint) )
+            return GLUCOSE_UNSAT;
+    while ( 1 )
+    {
+        status = bmcg_sat_solver_solve( p->pSat, NULL, 0 );
+        if ( status != GLUCOSE_SAT )
+            break;
+        iMint = Exa_ManEval( p );
+        if ( iMint == -1 )
+            break;
+        assert( Vec_IntEntry(p->vMintVars, iMint) == -1 );
+        if ( !Exa_ManAddCnf( p, iMint ) || !Exa_ManTemplateAddValue(p, iMint) )
+        {
+            status = GLUCOSE_UNSAT;
+            break;
+        }
+    }
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the smallest realization for each function in the file.]
+
+  Description [The file lists truth tables in hex notation, one per line.
+  For each function, the gate count is increased until a solution is found
+  or the limit (pPars->nNodes) is reached. Functions not depending on some
+  of their inputs are solved on their support. The templates are kept for
+  the whole run, one for each pair (number of inputs, number of gates).
+  Since the gate library is closed under input/output complementation,
+  NPN-equivalent functions have the same gate count, which is cached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Exa_ManExactSynthesisFile( Bmc_EsPar_t * pPars, char * pFileName )
+{
+    Exa_Man_t * pTemps[11][MAJ_NOBJS] = {{NULL}};
+    Bmc_EsPar_t Pars[11][MAJ_NOBJS];
+    Vec_Mem_t * vTtMems[11] = {NULL};  // NPN classes seen
+    Vec_Int_t * vCounts[11] = {NULL};  // their gate counts (-1 = unknown, -2 = none within the limit)
+    abctime clkTotal = Abc_Clock();
+    char Buffer[1000], * pToken;
+    int i, k, nFuncs = 0, nSolved = 0, nGatesAll = 0, nCached = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return;
+    }
+    if ( pPars->nNodes < 1 || pPars->nNodes > MAJ_NOBJS - 11 )
+    {
+        printf( "The gate limit (%d) should be between 1 and %d.\n", pPars->nNodes, MAJ_NOBJS - 11 );
+        fclose( pFile );
+        return;
+    }
+    while ( fgets( Buffer, 1000, pFile ) != NULL )
+    {
+        abctime clk = Abc_Clock();
+        word pTruth[16], pCanon[16]; char pPerm[16];
+        int nVars, nSupp, nGates = -1, fCompl = 0, fCached = 0, iClass = -1, status = GLUCOSE_UNSAT;
+        pToken = strtok( Buffer, " \t\r\n" );
+        if ( pToken == NULL )
+            continue;
+        if ( strlen(pToken) > 256 )
+        {
+            printf( "Skipping function \"%s\" with more than 10 inputs.\n", pToken );
+            continue;
+        }
+        nVars = Abc_TtReadHex( pTruth, pToken );
+        nSupp = Abc_TtMinBase( pTruth, NULL, nVars, nVars );
+        if ( pTruth[0] & 1 ) { fCompl = 1; Abc_TtNot( pTruth, Abc_TtWordNum(nVars) ); }
+        nFuncs++;
+        if ( nSupp < 2 )
+            nGates = 0, status = GLUCOSE_SAT;
+        else
+        {
+            if ( vTtMems[nSupp] == NULL )
+            {
+                vTtMems[nSupp] = Vec_MemAllocForTTSimple( nSupp );
+                vCounts[nSupp] = Vec_IntAlloc( 1000 );
+            }
+            Abc_TtCopy( pCanon, pTruth, Abc_TtWordNum(nSupp), 0 );
+            Abc_TtCanonicize( pCanon, nSupp, pPerm );
+            iClass = Vec_MemHashInsert( vTtMems[nSupp], pCanon );
+            nGates = Vec_IntGetEntryFull( vCounts[nSupp], iClass );
+            if ( nGates != -1 )
+            {
+                status = nGates >= 0 ? GLUCOSE_SAT : GLUCOSE_UNSAT;
+                fCached = 1;
+                nCached++;
+            }
+        }
+        for ( k = nSupp - 1; nSupp >= 2 && nGates == -1 && k <= pPars->nNodes; k++ )
+        {
+            if ( pTemps[nSupp][k] == NULL )
+            {
+                Pars[nSupp][k] = *pPars;
+                Pars[nSupp][k].nVars      = nSupp;
+                Pars[nSupp][k].nNodes     = k;
+                Pars[nSupp][k].fDynConstr = 0;
+                Pars[nSupp][k].fDumpCnf   = 0;
+                pTemps[nSupp][k] = Exa_ManTemplateAlloc( &Pars[nSupp][k] );
+                if ( pTemps[nSupp][k] == NULL )
+                    continue;
+            }
+            status = Exa_ManTemplateSolve( pTemps[nSupp][k], pTruth );
+            if ( status == GLUCOSE_UNSAT )
+                continue;
+            if ( status == GLUCOSE_SAT )
+                nGates = k;
+            break;
+        }
+        if ( iClass >= 0 && status != GLUCOSE_UNDEC )
+            Vec_IntSetEntryFull( vCounts[nSupp], iClass, status == GLUCOSE_SAT ? nGates : -2 );
+        printf( "Function %4d : %s  Inputs = %2d  Gates = ", nFuncs, pToken, nSupp );
+        if ( status == GLUCOSE_SAT )
+            printf( "%3d%s  ", nGates, fCached ? " (NPN class seen before)" : "" ), nSolved++, nGatesAll += nGates;
+        else
+            printf( "%s  ", status == GLUCOSE_UNDEC ? "timeout" : "  n/a" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        if ( pPars->fVerbose && nGates > 0 && !fCached )
+            Exa_ManPrintSolution( pTemps[nSupp][nGates], fCompl );
+    }
+    fclose( pFile );
+    for ( i = 0; i < 11; i++ )
+    {
+        for ( k = 0; k < MAJ_NOBJS; k++ )
+            if ( pTemps[i][k] )
+                Exa_ManFree( pTemps[i][k] );
+        if ( vTtMems[i] )
+        {
+            Vec_MemHashFree( vTtMems[i] );
+            Vec_MemFree( vTtMems[i] );
+            Vec_IntFree( vCounts[i] );
+        }
+    }
+    printf( "Solved %d out of %d functions (%d by NPN class) using %d gates in total.  ", nSolved, nFuncs, nCached, nGatesAll );
+    Abc_PrintTime( 1, "Total runtime", Abc_Clock() - clkTotal );
+}
+
 
 
 
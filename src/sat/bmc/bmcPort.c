@@ -0,0 +1,625 @@
+/**CFile****************************************************************
+
+  FileName    [bmcPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Portfolio of concurrent SAT solvers with clause sharing.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: bmcPort.c,v 1.0 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose2/AbcGlucose2.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define BMC_PORT_MAX    100   // the max number of engines/threads
+#define BMC_SHR_SLOTS (1<<14) // the number of slots in the sharing ring
+
+// the clause pool is a ring of fixed-size slots; each slot stores
+// [sequence number, writer, clause size, literals]; the sequence number
+// is the index of the clause plus one, or zero while the slot is written
+struct Bmc_Shr_t_
+{
+    int             nThreads;               // the number of threads
+    int             nSizeMax;               // the largest clause size to share
+    int             nLbdMax;                // the largest LBD to share
+    int             nSlotSize;              // the number of words in one slot
+    int *           pSlots;                 // the slots of the ring
+    int *           pBuffs;                 // import buffers of the threads
+    volatile int    iWrite;                 // the number of clauses reserved by the writers
+    int             pRead[BMC_PORT_MAX];    // the number of clauses seen by each reader
+    int             nExported[BMC_PORT_MAX];// the number of clauses exported by each thread
+    int             nImported[BMC_PORT_MAX];// the number of clauses imported by each thread
+};
+
+// engine types
+enum { BMC_PORT_BSAT, BMC_PORT_SATOKO, BMC_PORT_GLUCOSE };
+
+typedef struct Bmc_PortEng_t_ Bmc_PortEng_t;
+struct Bmc_PortEng_t_
+{
+    Bmc_Port_t *    pMan;                   // portfolio manager
+    int             Type;                   // engine type
+    int             iEngine;                // engine number
+    void *          pSat;                   // SAT solver
+    int             iClause;                // the first clause not loaded into the solver
+    int             fUnsat;                 // the clauses are UNSAT without assumptions
+    int             status;                 // the result of the last call
+    Vec_Int_t *     vTemp;                  // temporary clause
+};
+
+struct Bmc_Port_t_
+{
+    int             nEngines;               // the number of engines
+    int             nConfLimit;             // conflict limit of one call
+    abctime         nRuntimeLimit;          // runtime limit (absolute time)
+    int             fVerbose;               // verbose stats
+    int             nVars;                  // the number of variables
+    int             nClauses;               // the number of clauses
+    Vec_Int_t *     vClauses;               // clauses added (size followed by literals)
+    Vec_Int_t *     vAssump;                // assumptions of the current call
+    Bmc_Shr_t *     pShr;                   // shared clause pool
+    Bmc_PortEng_t   pEngs[BMC_PORT_MAX];    // engines
+    int             nWins[BMC_PORT_MAX];    // the number of answers produced by each engine
+    volatile int    fStop;                  // signal when it is time to stop
+    volatile int    iWinner;                // the engine that produced the last answer
+    int             nCalls;                 // the number of calls
+    abctime         timeSat;                // runtime of the solvers
+};
+
+static char * Bmc_PortTypeName[3] = { "bsat", "satoko", "glucose" };
+
+// atomic operations
+#ifdef _MSC_VER
+static inline int  Bmc_ShrFetchAdd( volatile int * p )                { return (int)InterlockedIncrement( (volatile long *)p ) - 1;                    }
+static inline int  Bmc_ShrCas( volatile int * p, int Old, int New )   { return (int)InterlockedCompareExchange( (volatile long *)p, New, Old ) == Old; }
+static inline void Bmc_ShrBarrier()                                   { MemoryBarrier();                                                              }
+#else
+static inline int  Bmc_ShrFetchAdd( volatile int * p )                { return __sync_fetch_and_add( p, 1 );                                           }
+static inline int  Bmc_ShrCas( volatile int * p, int Old, int New )   { return __sync_bool_compare_and_swap( p, Old, New );                            }
+static inline void Bmc_ShrBarrier()                                   { __sync_synchronize();                                                          }
+#endif
+
+static inline int  Bmc_ShrIsLater( int a, int b )                     { return (int)((unsigned)a - (unsigned)b) > 0;                                   }
+static inline volatile int * Bmc_ShrSlot( Bmc_Shr_t * p, int i )      { return p->pSlots + (i & (BMC_SHR_SLOTS-1)) * p->nSlotSize;                    }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the shared clause pool.]
+
+  Description [The pool is a lock-free ring used by several threads
+  to exchange learned clauses. Clauses longer than nSizeMax literals or
+  with LBD above nLbdMax are not shared. When the writers outpace a reader,
+  the reader skips the overwritten clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Shr_t * Bmc_ShrAlloc( int nThreads, int nSizeMax, int nLbdMax )
+{
+    Bmc_Shr_t * p;
+    int i;
+    assert( nThreads > 0 && nThreads <= BMC_PORT_MAX );
+    assert( nSizeMax > 0 );
+    p = ABC_CALLOC( Bmc_Shr_t, 1 );
+    p->nThreads  = nThreads;
+    p->nSizeMax  = nSizeMax;
+    p->nLbdMax   = nLbdMax;
+    p->nSlotSize = nSizeMax + 3;
+    p->pSlots    = ABC_CALLOC( int, BMC_SHR_SLOTS * p->nSlotSize );
+    p->pBuffs    = ABC_CALLOC( int, nThreads * nSizeMax );
+    // mark the slots as written before the first clause
+    for ( i = 0; i < BMC_SHR_SLOTS; i++ )
+        p->pSlots[i * p->nSlotSize] = -1;
+    return p;
+}
+void Bmc_ShrFree( Bmc_Shr_t * p )
+{
+    ABC_FREE( p->pSlots );
+    ABC_FREE( p->pBuffs );
+    ABC_FREE( p );
+}
+void Bmc_ShrPrintStats( Bmc_Shr_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nThreads; i++ )
+        printf( "Thread %2d : Exported = %8d.  Imported = %8d.\n", i, p->nExported[i], p->nImported[i] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes a learned clause.]
+
+  Description [Can be called by several threads concurrently. The clause
+  is dropped if it is too long, if its LBD is too large (negative LBD
+  means that LBD is not known), or if a later clause already took the slot.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_ShrExport( void * pShr, int iThread, int * pLits, int nLits, int Lbd )
+{
+    Bmc_Shr_t * p = (Bmc_Shr_t *)pShr;
+    volatile int * pSlot;
+    int i, Seq, iClause;
+    if ( nLits > p->nSizeMax || (nLits > 1 && Lbd > p->nLbdMax) )
+        return;
+    iClause = Bmc_ShrFetchAdd( &p->iWrite );
+    pSlot = Bmc_ShrSlot( p, iClause );
+    // lock the slot unless it is being written or already holds a later clause
+    while ( 1 )
+    {
+        Seq = pSlot[0];
+        if ( Seq == 0 )
+            continue;
+        if ( Bmc_ShrIsLater(Seq, iClause + 1) )
+            return;
+        if ( Bmc_ShrCas( pSlot, Seq, 0 ) )
+            break;
+    }
+    pSlot[1] = iThread;
+    pSlot[2] = nLits;
+    for ( i = 0; i < nLits; i++ )
+        pSlot[3+i] = pLits[i];
+    Bmc_ShrBarrier();
+    pSlot[0] = iClause + 1;
+    p->nExported[iThread]++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the next clause published by another thread.]
+
+  Description [Returns NULL when there are no new clauses. The returned
+  literals are valid until the next call by the same thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int * Bmc_ShrImport( void * pShr, int iThread, int * pnLits )
+{
+    Bmc_Shr_t * p = (Bmc_Shr_t *)pShr;
+    int * pBuff = p->pBuffs + iThread * p->nSizeMax;
+    volatile int * pSlot;
+    int i, Seq, iWriter, nLits;
+    while ( 1 )
+    {
+        int iWrite = p->iWrite;
+        int * pRead = p->pRead + iThread;
+        if ( *pRead == iWrite )
+            return NULL;
+        // skip the clauses overwritten by the writers
+        if ( Bmc_ShrIsLater(iWrite - BMC_SHR_SLOTS, *pRead) )
+            *pRead = iWrite - BMC_SHR_SLOTS;
+        pSlot = Bmc_ShrSlot( p, *pRead );
+        Seq = pSlot[0];
+        if ( Seq != *pRead + 1 )
+        {
+            // the clause is not yet published
+            if ( Seq == 0 || !Bmc_ShrIsLater(Seq, *pRead + 1) )
+                return NULL;
+            // the clause was overwritten
+            (*pRead)++;
+            continue;
+        }
+        Bmc_ShrBarrier();
+        iWriter = pSlot[1];
+        nLits   = pSlot[2];
+        for ( i = 0; i < nLits && i < p->nSizeMax; i++ )
+            pBuff[i] = pSlot[3+i];
+        Bmc_ShrBarrier();
+        (*pRead)++;
+        // the clause was overwritten while being copied
+        if ( pSlot[0] != Seq )
+            continue;
+        if ( iWriter == iThread )
+            continue;
+        p->nImported[iThread]++;
+        *pnLits = nLits;
+        return pBuff;
+    }
+    return NULL;
+}
+
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the portfolio.]
+
+  Description [Engines alternate between bsat and satoko with different
+  random seeds and decay factors; the third engine is glucose. Learned
+  clauses are exchanged between bsat and satoko engines if fShare is set;
+  glucose only takes part in the race.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Port_t * Bmc_PortStart( int nEngines, int fShare, int fVerbose )
+{
+    Bmc_Port_t * p;
+    int i;
+    assert( nEngines >= 1 && nEngines <= BMC_PORT_MAX );
+    p = ABC_CALLOC( Bmc_Port_t, 1 );
+    p->nEngines = nEngines;
+    p->fVerbose = fVerbose;
+    p->iWinner  = -1;
+    p->vClauses = Vec_IntAlloc( 1 << 16 );
+    p->vAssump  = Vec_IntAlloc( 100 );
+    if ( fShare && nEngines > 1 )
+        p->pShr = Bmc_ShrAlloc( nEngines, 8, 6 );
+    for ( i = 0; i < nEngines; i++ )
+    {
+        Bmc_PortEng_t * pEng = p->pEngs + i;
+        pEng->pMan    = p;
+        pEng->iEngine = i;
+        pEng->Type    = i == 2 ? BMC_PORT_GLUCOSE : (i & 1) ? BMC_PORT_SATOKO : BMC_PORT_BSAT;
+        pEng->vTemp   = Vec_IntAlloc( 100 );
+        if ( pEng->Type == BMC_PORT_BSAT )
+        {
+            sat_solver * pSat = sat_solver_new();
+            pSat->random_seed += 7919 * i;
+            sat_solver_set_runid( pSat, i );
+            sat_solver_set_stop( pSat, (int *)&p->fStop );
+            if ( p->pShr )
+                sat_solver_set_share( pSat, p->pShr, Bmc_ShrExport, Bmc_ShrImport );
+            pEng->pSat = pSat;
+        }
+        else if ( pEng->Type == BMC_PORT_SATOKO )
+        {
+            satoko_t * pSat = satoko_create();
+            satoko_opts_t opts;
+            satoko_default_opts( &opts );
+            opts.var_decay -= 0.01 * (i / 2);
+            if ( opts.var_decay < 0.8 )
+                opts.var_decay = 0.8;
+            opts.no_simplify = 1;
+            satoko_configure( pSat, &opts );
+            satoko_set_runid( pSat, i );
+            satoko_set_stop( pSat, (int *)&p->fStop );
+            if ( p->pShr )
+                satoko_set_share( pSat, p->pShr, Bmc_ShrExport, Bmc_ShrImport );
+            pEng->pSat = pSat;
+        }
+        else if ( pEng->Type == BMC_PORT_GLUCOSE )
+        {
+            bmcg2_sat_solver * pSat = bmcg2_sat_solver_start();
+            bmcg2_sat_solver_set_stop( pSat, (int *)&p->fStop );
+            pEng->pSat = pSat;
+        }
+        else assert( 0 );
+    }
+    return p;
+}
+void Bmc_PortStop( Bmc_Port_t * p )
+{
+    int i;
+    if ( p->fVerbose )
+        Bmc_PortPrintStats( p );
+    for ( i = 0; i < p->nEngines; i++ )
+    {
+        Bmc_PortEng_t * pEng = p->pEngs + i;
+        if ( pEng->Type == BMC_PORT_BSAT )
+            sat_solver_delete( (sat_solver *)pEng->pSat );
+        else if ( pEng->Type == BMC_PORT_SATOKO )
+            satoko_destroy( (satoko_t *)pEng->pSat );
+        else if ( pEng->Type == BMC_PORT_GLUCOSE )
+            bmcg2_sat_solver_stop( (bmcg2_sat_solver *)pEng->pSat );
+        Vec_IntFree( pEng->vTemp );
+    }
+    if ( p->pShr )
+        Bmc_ShrFree( p->pShr );
+    Vec_IntFree( p->vClauses );
+    Vec_IntFree( p->vAssump );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loading the problem.]
+
+  Description [Clauses are recorded and loaded into the engines lazily,
+  by the engine threads, at the beginning of the next call.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortAddVar( Bmc_Port_t * p )
+{
+    return p->nVars++;
+}
+void Bmc_PortSetNVars( Bmc_Port_t * p, int nVars )
+{
+    p->nVars = Abc_MaxInt( p->nVars, nVars );
+}
+int Bmc_PortVarNum( Bmc_Port_t * p )
+{
+    return p->nVars;
+}
+int Bmc_PortAddClause( Bmc_Port_t * p, int * pLits, int nLits )
+{
+    int i;
+    if ( nLits == 0 )
+        return 0;
+    Vec_IntPush( p->vClauses, nLits );
+    p->nClauses++;
+    for ( i = 0; i < nLits; i++ )
+    {
+        assert( pLits[i] >= 0 );
+        Vec_IntPush( p->vClauses, pLits[i] );
+        Bmc_PortSetNVars( p, Abc_Lit2Var(pLits[i]) + 1 );
+    }
+    return 1;
+}
+void Bmc_PortSetConflictLimit( Bmc_Port_t * p, int nConfLimit )
+{
+    p->nConfLimit = nConfLimit;
+}
+void Bmc_PortSetRuntimeLimit( Bmc_Port_t * p, abctime nRuntimeLimit )
+{
+    p->nRuntimeLimit = nRuntimeLimit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_PortEngLoad( Bmc_PortEng_t * pEng )
+{
+    Bmc_Port_t * p = pEng->pMan;
+    int * pClause, RetValue = 1;
+    while ( pEng->iClause < Vec_IntSize(p->vClauses) )
+    {
+        pClause = Vec_IntEntryP( p->vClauses, pEng->iClause );
+        pEng->iClause += pClause[0] + 1;
+        // satoko sorts the literals in place
+        Vec_IntClear( pEng->vTemp );
+        Vec_IntPushArray( pEng->vTemp, pClause + 1, pClause[0] );
+        if ( pEng->Type == BMC_PORT_BSAT )
+            RetValue = sat_solver_addclause( (sat_solver *)pEng->pSat, Vec_IntArray(pEng->vTemp), Vec_IntLimit(pEng->vTemp) );
+        else if ( pEng->Type == BMC_PORT_SATOKO )
+            RetValue = satoko_add_clause( (satoko_t *)pEng->pSat, Vec_IntArray(pEng->vTemp), Vec_IntSize(pEng->vTemp) ) == SATOKO_OK;
+        else if ( pEng->Type == BMC_PORT_GLUCOSE )
+            RetValue = bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)pEng->pSat, Vec_IntArray(pEng->vTemp), Vec_IntSize(pEng->vTemp) );
+        if ( !RetValue )
+            return 0;
+    }
+    // make sure all variables exist
+    if ( pEng->Type == BMC_PORT_BSAT )
+        sat_solver_setnvars( (sat_solver *)pEng->pSat, p->nVars );
+    else if ( pEng->Type == BMC_PORT_SATOKO )
+        satoko_setnvars( (satoko_t *)pEng->pSat, p->nVars );
+    else if ( pEng->Type == BMC_PORT_GLUCOSE )
+        bmcg2_sat_solver_set_nvars( (bmcg2_sat_solver *)pEng->pSat, p->nVars );
+    return 1;
+}
+static void Bmc_PortEngSolve( Bmc_PortEng_t * pEng )
+{
+    Bmc_Port_t * p = pEng->pMan;
+    int * pLits = Vec_IntArray( p->vAssump );
+    int nLits = Vec_IntSize( p->vAssump );
+    pEng->status = l_Undef;
+    if ( !pEng->fUnsat && !Bmc_PortEngLoad(pEng) )
+        pEng->fUnsat = 1;
+    if ( pEng->fUnsat )
+        pEng->status = l_False;
+    else if ( pEng->Type == BMC_PORT_BSAT )
+    {
+        sat_solver * pSat = (sat_solver *)pEng->pSat;
+        sat_solver_set_runtime_limit( pSat, p->nRuntimeLimit );
+        pEng->status = sat_solver_solve( pSat, pLits, pLits + nLits, (ABC_INT64_T)p->nConfLimit, 0, 0, 0 );
+    }
+    else if ( pEng->Type == BMC_PORT_SATOKO )
+    {
+        satoko_t * pSat = (satoko_t *)pEng->pSat;
+        satoko_set_runtime_limit( pSat, p->nRuntimeLimit );
+        pEng->status = satoko_solve_assumptions_limit( pSat, pLits, nLits, p->nConfLimit );
+    }
+    else if ( pEng->Type == BMC_PORT_GLUCOSE )
+    {
+        bmcg2_sat_solver * pSat = (bmcg2_sat_solver *)pEng->pSat;
+        bmcg2_sat_solver_set_runtime_limit( pSat, p->nRuntimeLimit );
+        bmcg2_sat_solver_set_conflict_budget( pSat, p->nConfLimit );
+        pEng->status = bmcg2_sat_solver_solve( pSat, pLits, nLits );
+    }
+    if ( pEng->status == l_False && nLits == 0 )
+        pEng->fUnsat = 1;
+    // the first engine with an answer stops the others
+    if ( pEng->status != l_Undef && Bmc_ShrCas( &p->iWinner, -1, pEng->iEngine ) )
+        p->fStop = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [Returns l_True, l_False, or l_Undef, similar to bsat.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int Bmc_PortSolve( Bmc_Port_t * p, int * pLits, int nLits )
+{
+    abctime clk = Abc_Clock();
+    Vec_IntClear( p->vAssump );
+    Vec_IntPushArray( p->vAssump, pLits, nLits );
+    p->iWinner = -1;
+    Bmc_PortEngSolve( p->pEngs );
+    if ( p->iWinner >= 0 )
+        p->nWins[p->iWinner]++;
+    p->fStop = 0;
+    p->nCalls++;
+    p->timeSat += Abc_Clock() - clk;
+    return p->pEngs[0].status;
+}
+
+#else // pthreads are used
+
+void * Bmc_PortWorkerThread( void * pArg )
+{
+    Bmc_PortEngSolve( (Bmc_PortEng_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+int Bmc_PortSolve( Bmc_Port_t * p, int * pLits, int nLits )
+{
+    pthread_t WorkerThread[BMC_PORT_MAX];
+    abctime clk = Abc_Clock();
+    int i, status;
+    Vec_IntClear( p->vAssump );
+    Vec_IntPushArray( p->vAssump, pLits, nLits );
+    p->iWinner = -1;
+    p->fStop = 0;
+    if ( p->nEngines == 1 )
+        Bmc_PortEngSolve( p->pEngs );
+    else
+    {
+        for ( i = 0; i < p->nEngines; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Bmc_PortWorkerThread, (void *)(p->pEngs + i) );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < p->nEngines; i++ )
+            pthread_join( WorkerThread[i], NULL );
+    }
+    p->fStop = 0;
+    p->nCalls++;
+    p->timeSat += Abc_Clock() - clk;
+    if ( p->iWinner == -1 )
+        return l_Undef;
+    p->nWins[p->iWinner]++;
+    return p->pEngs[p->iWinner].status;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the results of the last call.]
+
+  Description [The final conflict is expressed in terms of the negated
+  assumptions, as in the individual solvers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortWinner( Bmc_Port_t * p )
+{
+    return p->iWinner;
+}
+int Bmc_PortVarValue( Bmc_Port_t * p, int iVar )
+{
+    Bmc_PortEng_t * pEng = p->pEngs + Abc_MaxInt(p->iWinner, 0);
+    assert( pEng->status == l_True );
+    if ( pEng->Type == BMC_PORT_BSAT )
+        return sat_solver_var_value( (sat_solver *)pEng->pSat, iVar );
+    if ( pEng->Type == BMC_PORT_SATOKO )
+        return satoko_read_cex_varvalue( (satoko_t *)pEng->pSat, iVar );
+    if ( pEng->Type == BMC_PORT_GLUCOSE )
+        return bmcg2_sat_solver_read_cex_varvalue( (bmcg2_sat_solver *)pEng->pSat, iVar );
+    assert( 0 );
+    return 0;
+}
+int Bmc_PortFinal( Bmc_Port_t * p, int ** ppArray )
+{
+    Bmc_PortEng_t * pEng = p->pEngs + Abc_MaxInt(p->iWinner, 0);
+    assert( pEng->status == l_False );
+    *ppArray = NULL;
+    if ( pEng->fUnsat )
+        return 0;
+    if ( pEng->Type == BMC_PORT_BSAT )
+        return sat_solver_final( (sat_solver *)pEng->pSat, ppArray );
+    if ( pEng->Type == BMC_PORT_SATOKO )
+        return Abc_MaxInt( satoko_final_conflict( (satoko_t *)pEng->pSat, ppArray ), 0 );
+    if ( pEng->Type == BMC_PORT_GLUCOSE )
+        return bmcg2_sat_solver_final( (bmcg2_sat_solver *)pEng->pSat, ppArray );
+    assert( 0 );
+    return 0;
+}
+void Bmc_PortPrintStats( Bmc_Port_t * p )
+{
+    int i;
+    printf( "Portfolio with %d engines: Vars = %d. Clauses = %d. Calls = %d.  ", p->nEngines, p->nVars, p->nClauses, p->nCalls );
+    Abc_PrintTime( 1, "Time", p->timeSat );
+    for ( i = 0; i < p->nEngines; i++ )
+    {
+        Bmc_PortEng_t * pEng = p->pEngs + i;
+        int nConfs = 0;
+        if ( pEng->Type == BMC_PORT_BSAT )
+            nConfs = sat_solver_nconflicts( (sat_solver *)pEng->pSat );
+        else if ( pEng->Type == BMC_PORT_SATOKO )
+            nConfs = satoko_conflictnum( (satoko_t *)pEng->pSat );
+        else if ( pEng->Type == BMC_PORT_GLUCOSE )
+            nConfs = bmcg2_sat_solver_conflictnum( (bmcg2_sat_solver *)pEng->pSat );
+        printf( "Engine %2d (%-7s) : Wins = %6d.  Conflicts = %10d.", i, Bmc_PortTypeName[pEng->Type], p->nWins[i], nConfs );
+        if ( p->pShr )
+            printf( "  Exported = %8d.  Imported = %8d.", p->pShr->nExported[i], p->pShr->nImported[i] );
+        printf( "\n" );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -584,10 +584,19 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     assert(lit_neg(begin[0]) < s->size*2);
     assert(lit_neg(begin[1]) < s->size*2);
 
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    // long clauses are watched by the handle followed by the other watched literal
+    if ( size > 2 )
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),h);
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),begin[1]);
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),h);
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
@@ -1076,9 +1085,20 @@ int sat_solver_propagate(sat_solver* s)
                     while (i < end)
                         *j++ = *i++;
                 }
+                else
+                    i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                // If the blocker is true, then clause is already satisfied.
+                lit blocker = i[1];
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1090,34 +1110,41 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
                     lit* k;
                     for (k = lits + 2; k < stop; k++){
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
+                            veci* wnew = sat_solver_read_wlist(s,lit_neg(*k));
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            veci_push(wnew,*i);
+                            veci_push(wnew,lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        break;
                     }
                 }
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1612,12 +1639,18 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[++k]; // blocker
+            }
             else 
             {
-                c = clause_read(s, pArray[k]);
+                c = clause_read(s, pArray[k++]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k]; // blocker
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1678,8 +1711,11 @@ void sat_solver_rollback( sat_solver* s )
                 if ( clause_read_lit(pArray[k]) < s->iVarPivot*2 )
                     pArray[j++] = pArray[k];
             }
-            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
-                pArray[j++] = pArray[k];
+            else if ( Sat_MemClauseUsed(pMem, pArray[k++]) )
+            {
+                pArray[j++] = pArray[k-1];
+                pArray[j++] = pArray[k]; // blocker
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -1866,6 +1902,8 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             blevel = s->root_level > blevel ? s->root_level : blevel;
             sat_solver_canceluntil(s,blevel);
             sat_solver_record(s,&learnt_clause);
+            if ( s->pFuncExport )
+                s->pFuncExport( s->pShare, s->RunId, veci_begin(&learnt_clause), veci_size(&learnt_clause), -1 );
 #ifdef SAT_USE_ANALYZE_FINAL
 //            if (learnt_clause.size() == 1) level[var(learnt_clause[0])] = 0;    // (this is ugly (but needed for 'analyzeFinal()') -- in future versions, we will backtrack past the 'root_level' and redo the assumptions)
             if ( learnt_clause.size == 1 ) 
@@ -1879,7 +1917,7 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             int next;
 
             // Reached bound on number of conflicts:
-            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || (s->pstop && *s->pstop) ){
                 s->progress_estimate = sat_solver_progress(s);
                 sat_solver_canceluntil(s,s->root_level);
                 veci_delete(&learnt_clause);
@@ -1937,6 +1975,17 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
     return l_Undef; // cannot happen
 }
 
+// adds clauses learned by other solvers (returns 0 if the problem became UNSAT)
+static int sat_solver_import(sat_solver* s)
+{
+    int * pLits, nLits;
+    assert( sat_solver_dl(s) == 0 );
+    while ( (pLits = s->pFuncImport(s->pShare, s->RunId, &nLits)) )
+        if ( !sat_solver_addclause(s, pLits, pLits + nLits) )
+            return 0;
+    return 1;
+}
+
 // internal call to the SAT solver
 int sat_solver_solve_internal(sat_solver* s)
 {
@@ -1982,6 +2031,14 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pstop && *s->pstop )
+            break;
+        // pick up clauses learned by other solvers
+        if ( status == l_Undef && s->pFuncImport && sat_solver_dl(s) == 0 && !sat_solver_import(s) )
+        {
+            veci_resize(&s->conf_final, 0);
+            status = l_False;
+        }
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -2086,6 +2143,13 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
 
     sat_solver_set_resource_limits( s, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
 
+    // pick up clauses learned by other solvers before the assumptions are pushed
+    if ( s->pFuncImport && sat_solver_dl(s) == 0 && !sat_solver_import(s) )
+    {
+        veci_resize(&s->conf_final, 0);
+        return l_False;
+    }
+
 #ifdef SAT_USE_ANALYZE_FINAL
     // Perform assumptions:
     s->root_level = 0;
@@ -206,6 +206,12 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pstop;          // external flag to terminate
+
+    // clause sharing
+    void *      pShare;         // external clause sharing manager
+    void(*pFuncExport)(void *, int, int *, int, int); // exports a learned clause (manager, RunId, lits, size, LBD)
+    int*(*pFuncImport)(void *, int, int *);           // imports the next clause learned elsewhere (manager, RunId, size)
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -361,6 +367,16 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pstop ) 
+{ 
+    s->pstop = pstop; 
+}
+static inline void sat_solver_set_share( sat_solver *s, void * pShare, void (*pExport)(void *, int, int *, int, int), int * (*pImport)(void *, int, int *) ) 
+{ 
+    s->pShare      = pShare; 
+    s->pFuncExport = pExport; 
+    s->pFuncImport = pImport; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
@@ -1050,7 +1050,7 @@ static lbool solver2_search(sat_solver2* s, ABC_INT64_T nof_conflicts)
             // NO CONFLICT
             int next;
 
-            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || (s->pstop && *s->pstop)){
                 // Reached bound on number of conflicts:
                 s->progress_estimate = solver2_progress(s);
                 solver2_canceluntil(s,s->root_level);
@@ -1960,6 +1960,8 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
         }
         if ( s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit )
             break;
+        if ( s->pstop && *s->pstop )
+            break;
         // reduce the set of learnt clauses
         if ( s->nLearntMax && veci_size(&s->act_clas) >= s->nLearntMax && s->pPrf2 == NULL )
             sat_solver2_reducedb(s);
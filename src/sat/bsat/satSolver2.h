@@ -173,6 +173,7 @@ struct sat_solver2_t
     ABC_INT64_T     nConfLimit;     // external limit on the number of conflicts
     ABC_INT64_T     nInsLimit;      // external limit on the number of implications
     abctime         nRuntimeLimit;  // external limit on runtime
+    int *           pstop;          // external flag to terminate the run
 };
 
 static inline clause * clause2_read( sat_solver2 * s, cla h )                  { return Sat_MemClauseHand( &s->Mem, h ); }
@@ -238,6 +239,11 @@ static inline abctime sat_solver2_set_runtime_limit(sat_solver2* s, abctime Limi
     return temp;
 }
 
+static inline void sat_solver2_set_stop(sat_solver2* s, int * pstop)
+{
+    s->pstop = pstop;
+}
+
 static inline int sat_solver2_set_learntmax(sat_solver2* s, int nLearntMax)
 {
     int temp = s->nLearntMax;
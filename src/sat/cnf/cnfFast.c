@@ -21,12 +21,40 @@
 #include "cnf.h"
 #include "bool/kit/kit.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// thread-local data used to derive clauses without touching the AIG
+typedef struct Cnf_FastTh_t_ Cnf_FastTh_t;
+struct Cnf_FastTh_t_
+{
+    Aig_Man_t *     p;           // the AIG manager
+    Vec_Int_t *     vMap;        // mapping of objects into SAT variables
+    Vec_Ptr_t *     vRoots;      // the nodes to derive the clauses for
+    int             iStart;      // the first root of this chunk
+    int             iStop;       // the last root of this chunk (not included)
+    Vec_Int_t *     vLits;       // the literals of the clauses of this chunk
+    Vec_Int_t *     vClas;       // the clause beginnings in vLits
+    int *           pStamps;     // visited marks of the objects
+    int *           pIndex;      // positions of the objects in the cone
+    int             nStamp;      // the current visited mark
+    word            Sims[256];   // truth tables of the cone
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -166,6 +194,81 @@ word Cnf_CutDeriveTruth( Aig_Man_t * p, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Collects nodes inside the cone using thread-local marks.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_CollectVolumeTh_rec( Cnf_FastTh_t * pTh, Aig_Obj_t * pObj, Vec_Ptr_t * vNodes )
+{
+    if ( pTh->pStamps[Aig_ObjId(pObj)] == pTh->nStamp )
+        return;
+    pTh->pStamps[Aig_ObjId(pObj)] = pTh->nStamp;
+    assert( Aig_ObjIsNode(pObj) );
+    Cnf_CollectVolumeTh_rec( pTh, Aig_ObjFanin0(pObj), vNodes );
+    Cnf_CollectVolumeTh_rec( pTh, Aig_ObjFanin1(pObj), vNodes );
+    Vec_PtrPush( vNodes, pObj );
+}
+void Cnf_CollectVolumeTh( Cnf_FastTh_t * pTh, Aig_Obj_t * pRoot, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes )
+{
+    Aig_Obj_t * pObj;
+    int i;
+    pTh->nStamp++;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pObj, i )
+        pTh->pStamps[Aig_ObjId(pObj)] = pTh->nStamp;
+    Vec_PtrClear( vNodes );
+    Cnf_CollectVolumeTh_rec( pTh, pRoot, vNodes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives truth table using thread-local storage.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Cnf_CutDeriveTruthTh( Cnf_FastTh_t * pTh, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes )
+{
+    static word Truth6[6] = {
+        ABC_CONST(0xAAAAAAAAAAAAAAAA),
+        ABC_CONST(0xCCCCCCCCCCCCCCCC),
+        ABC_CONST(0xF0F0F0F0F0F0F0F0),
+        ABC_CONST(0xFF00FF00FF00FF00),
+        ABC_CONST(0xFFFF0000FFFF0000),
+        ABC_CONST(0xFFFFFFFF00000000)
+    };
+    static word C[2] = { 0, ~(word)0 };
+    word * S = pTh->Sims;
+    int * pIndex = pTh->pIndex;
+    Aig_Obj_t * pObj = NULL;
+    int i;
+    assert( Vec_PtrSize(vLeaves) <= 6 && Vec_PtrSize(vNodes) > 0 );
+    assert( Vec_PtrSize(vLeaves) + Vec_PtrSize(vNodes) <= 256 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pObj, i )
+    {
+        pIndex[Aig_ObjId(pObj)] = i;
+        S[i] = Truth6[i];
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        pIndex[Aig_ObjId(pObj)] = Vec_PtrSize(vLeaves) + i;
+        S[Vec_PtrSize(vLeaves) + i] = (S[pIndex[Aig_ObjFaninId0(pObj)]] ^ C[Aig_ObjFaninC0(pObj)]) & 
+                                      (S[pIndex[Aig_ObjFaninId1(pObj)]] ^ C[Aig_ObjFaninC1(pObj)]);
+    }
+    return S[pIndex[Aig_ObjId(pObj)]];
+}
+
+
 /**Function*************************************************************
 
   Synopsis    [Collects nodes inside the cone.]
@@ -186,17 +289,18 @@ static inline int Cnf_ObjGetLit( Vec_Int_t * vMap, Aig_Obj_t * pObj, int fCompl
 
 /**Function*************************************************************
 
-  Synopsis    [Collects nodes inside the cone.]
+  Synopsis    [Derives clauses for the cone rooted at the node.]
 
-  Description []
+  Description [If the thread-local data is given, the AIG is not modified,
+  so that several threads can derive clauses of different nodes at once.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, 
-    Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses )
+void Cnf_ComputeClausesInt( Aig_Man_t * p, Aig_Obj_t * pRoot, 
+    Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses, Cnf_FastTh_t * pTh )
 {
     Aig_Obj_t * pLeaf;
     int c, k, Cube, OutLit, RetValue;
@@ -208,7 +312,10 @@ void Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot,
     OutLit = Cnf_ObjGetLit( vMap, pRoot, 0 );
     // detect cone
     Cnf_CollectLeaves( pRoot, vLeaves, 0 );
-    Cnf_CollectVolume( p, pRoot, vLeaves, vNodes );
+    if ( pTh )
+        Cnf_CollectVolumeTh( pTh, pRoot, vLeaves, vNodes );
+    else
+        Cnf_CollectVolume( p, pRoot, vLeaves, vNodes );
     assert( pRoot == Vec_PtrEntryLast(vNodes) );
     // check if this is an AND-gate
     Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pLeaf, k )
@@ -239,7 +346,7 @@ void Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot,
         printf( "FastCnfGeneration:  Internal error!!!\n" );
     assert( Vec_PtrSize(vLeaves) <= 6 );
 
-    Truth = Cnf_CutDeriveTruth( p, vLeaves, vNodes );
+    Truth = pTh ? Cnf_CutDeriveTruthTh( pTh, vLeaves, vNodes ) : Cnf_CutDeriveTruth( p, vLeaves, vNodes );
     if ( Truth == 0 || Truth == ~(word)0 )
     {
         Vec_IntPush( vClauses, 0 );
@@ -280,8 +387,11 @@ void Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot,
         }
     }
 }
-
-
+void Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, 
+    Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses )
+{
+    Cnf_ComputeClausesInt( p, pRoot, vLeaves, vNodes, vMap, vCover, vClauses, NULL );
+}
 
 /**Function*************************************************************
 
@@ -530,6 +640,128 @@ int Cnf_CountCnfSize( Aig_Man_t * p )
     return nClauses;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Appends the clauses of one node to the CNF.]
+
+  Description [The clauses in vTemp are separated by zeros.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_DeriveFastAppend( Vec_Int_t * vTemp, Vec_Int_t * vLits, Vec_Int_t * vClas )
+{
+    int k, Entry;
+    Vec_IntForEachEntry( vTemp, Entry, k )
+    {
+        if ( Entry == 0 )
+            Vec_IntPush( vClas, Vec_IntSize(vLits) );
+        else
+            Vec_IntPush( vLits, Entry );
+    }       
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives clauses for a chunk of nodes.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cnf_DeriveFastWorkerThread( void * pArg )
+{
+    Cnf_FastTh_t * pTh = (Cnf_FastTh_t *)pArg;
+    Vec_Ptr_t * vLeaves = Vec_PtrAlloc( 100 );
+    Vec_Ptr_t * vNodes  = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vCover  = Vec_IntAlloc( 1 << 16 );
+    Vec_Int_t * vTemp   = Vec_IntAlloc( 100 );
+    Aig_Obj_t * pObj;
+    int i;
+    Vec_PtrForEachEntryStartStop( Aig_Obj_t *, pTh->vRoots, pObj, i, pTh->iStart, pTh->iStop )
+    {
+        Cnf_ComputeClausesInt( pTh->p, pObj, vLeaves, vNodes, pTh->vMap, vCover, vTemp, pTh );
+        Cnf_DeriveFastAppend( vTemp, pTh->vLits, pTh->vClas );
+    }
+    Vec_PtrFree( vLeaves );
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vCover );
+    Vec_IntFree( vTemp );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives clauses for the nodes using several threads.]
+
+  Description [The roots are split into contiguous chunks, one per thread. 
+  Each thread writes the clauses of its chunk into its own arrays, which 
+  are appended to the CNF in the original order and released one by one,
+  so the result is the same as the one produced by a single thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_DeriveFastClausesPar( Aig_Man_t * p, Vec_Int_t * vMap, Vec_Ptr_t * vRoots, int nProcs, Vec_Int_t * vLits, Vec_Int_t * vClas )
+{
+    Cnf_FastTh_t * pThData;
+    int i, k, Entry, Offset, nChunk;
+#ifdef ABC_USE_PTHREADS
+    int status;
+#else
+    nProcs = 1;
+#endif
+    nChunk  = (Vec_PtrSize(vRoots) + nProcs - 1) / Abc_MaxInt(nProcs, 1);
+    pThData = ABC_CALLOC( Cnf_FastTh_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].p       = p;
+        pThData[i].vMap    = vMap;
+        pThData[i].vRoots  = vRoots;
+        pThData[i].iStart  = Abc_MinInt( i * nChunk, Vec_PtrSize(vRoots) );
+        pThData[i].iStop   = Abc_MinInt( (i + 1) * nChunk, Vec_PtrSize(vRoots) );
+        pThData[i].vLits   = Vec_IntAlloc( 1 << 12 );
+        pThData[i].vClas   = Vec_IntAlloc( 1 << 10 );
+        pThData[i].pStamps = ABC_CALLOC( int, Aig_ManObjNumMax(p) );
+        pThData[i].pIndex  = ABC_CALLOC( int, Aig_ManObjNumMax(p) );
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nProcs > 1 )
+    {
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nProcs );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            status = pthread_create( pThreads + i, NULL, Cnf_DeriveFastWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nProcs; i++ )
+            pthread_join( pThreads[i], NULL );
+        ABC_FREE( pThreads );
+    }
+    else
+#endif
+        Cnf_DeriveFastWorkerThread( (void *)pThData );
+    // append the chunks in order
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Offset = Vec_IntSize(vLits);
+        Vec_IntForEachEntry( pThData[i].vClas, Entry, k )
+            Vec_IntPush( vClas, Offset + Entry );
+        Vec_IntAppend( vLits, pThData[i].vLits );
+        Vec_IntFree( pThData[i].vLits );
+        Vec_IntFree( pThData[i].vClas );
+        ABC_FREE( pThData[i].pStamps );
+        ABC_FREE( pThData[i].pIndex );
+    }
+    ABC_FREE( pThData );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives CNF from the marked AIG.]
@@ -542,14 +774,14 @@ int Cnf_CountCnfSize( Aig_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs )
+Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs, int nProcs )
 {
     Cnf_Dat_t * pCnf;
     Vec_Int_t * vLits, * vClas, * vMap, * vTemp;
     Vec_Ptr_t * vLeaves, * vNodes;
     Vec_Int_t * vCover;
     Aig_Obj_t * pObj;
-    int i, k, nVars, Entry, OutLit, DriLit;
+    int i, nVars, Entry, OutLit, DriLit;
 
     vLits = Vec_IntAlloc( 1 << 16 );
     vClas = Vec_IntAlloc( 1 << 12 );
@@ -582,27 +814,33 @@ Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs )
     Vec_IntWriteEntry( vMap, Aig_ObjId(Aig_ManConst1(p)), nVars++ );
 
     // create clauses
-    vLeaves = Vec_PtrAlloc( 100 );
-    vNodes  = Vec_PtrAlloc( 100 );
-    vCover  = Vec_IntAlloc( 1 << 16 );
-    vTemp   = Vec_IntAlloc( 100 );
-    Aig_ManForEachNodeReverse( p, pObj, i )
+    if ( nProcs > 1 )
     {
-        if ( !pObj->fMarkA )
-            continue;
-        Cnf_ComputeClauses( p, pObj, vLeaves, vNodes, vMap, vCover, vTemp );
-        Vec_IntForEachEntry( vTemp, Entry, k )
+        Vec_Ptr_t * vRoots = Vec_PtrAlloc( Aig_ManNodeNum(p) );
+        Aig_ManForEachNodeReverse( p, pObj, i )
+            if ( pObj->fMarkA )
+                Vec_PtrPush( vRoots, pObj );
+        Cnf_DeriveFastClausesPar( p, vMap, vRoots, nProcs, vLits, vClas );
+        Vec_PtrFree( vRoots );
+    }
+    else
+    {
+        vLeaves = Vec_PtrAlloc( 100 );
+        vNodes  = Vec_PtrAlloc( 100 );
+        vCover  = Vec_IntAlloc( 1 << 16 );
+        vTemp   = Vec_IntAlloc( 100 );
+        Aig_ManForEachNodeReverse( p, pObj, i )
         {
-            if ( Entry == 0 )
-                Vec_IntPush( vClas, Vec_IntSize(vLits) );
-            else
-                Vec_IntPush( vLits, Entry );
-        }       
+            if ( !pObj->fMarkA )
+                continue;
+            Cnf_ComputeClauses( p, pObj, vLeaves, vNodes, vMap, vCover, vTemp );
+            Cnf_DeriveFastAppend( vTemp, vLits, vClas );
+        }
+        Vec_PtrFree( vLeaves );
+        Vec_PtrFree( vNodes );
+        Vec_IntFree( vCover );
+        Vec_IntFree( vTemp );
     }
-    Vec_PtrFree( vLeaves );
-    Vec_PtrFree( vNodes );
-    Vec_IntFree( vCover );
-    Vec_IntFree( vTemp );
 
     // create clauses for the outputs
     Aig_ManForEachCo( p, pObj, i )
@@ -656,14 +894,14 @@ Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs )
 
   Synopsis    [Fast CNF computation.]
 
-  Description []
+  Description [Derives the clauses of the internal nodes using nProcs threads.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
+Cnf_Dat_t * Cnf_DeriveFastPar( Aig_Man_t * p, int nOutputs, int nProcs )
 {
     Cnf_Dat_t * pCnf = NULL;
     abctime clk;//, clkTotal = Abc_Clock();
@@ -675,7 +913,7 @@ Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
 //    Abc_PrintTime( 1, "Marking", Abc_Clock() - clk );
     // compute CNF size
     clk = Abc_Clock();
-    pCnf = Cnf_DeriveFastClauses( p, nOutputs );
+    pCnf = Cnf_DeriveFastClauses( p, nOutputs, nProcs );
 //    Abc_PrintTime( 1, "Clauses", Abc_Clock() - clk );
     // derive the resulting CNF
     Aig_ManCleanMarkA( p );
@@ -688,6 +926,22 @@ Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
     return pCnf;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Fast CNF computation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
+{
+    return Cnf_DeriveFastPar( p, nOutputs, 1 );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
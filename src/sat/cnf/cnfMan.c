@@ -284,6 +284,70 @@ void Cnf_DataPrint( Cnf_Dat_t * p, int fReadable )
     fprintf( pFile, "\n" );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses into a plain or a compressed file.]
+
+  Description [The text is produced in fixed-size chunks written with one 
+  call each, so the file is streamed without creating its image in memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Cnf_DataWriteNum( char * pCur, int Num )
+{
+    char Digits[16];
+    int nDigits = 0;
+    if ( Num < 0 )
+    {
+        *pCur++ = '-';
+        Num = -Num;
+    }
+    do Digits[nDigits++] = '0' + Num % 10; while ( (Num /= 10) > 0 );
+    while ( nDigits > 0 )
+        *pCur++ = Digits[--nDigits];
+    return pCur;
+}
+static inline void Cnf_DataWriteChunk( FILE * pFile, gzFile pFileGz, char * pBuffer, int nSize )
+{
+    if ( pFile )
+        fwrite( pBuffer, 1, (size_t)nSize, pFile );
+    else
+        gzwrite( pFileGz, pBuffer, (unsigned)nSize );
+}
+static void Cnf_DataWriteClauses( Cnf_Dat_t * p, FILE * pFile, gzFile pFileGz, int fReadable )
+{
+    int nChunkSize = (1 << 20);
+    char * pBuffer = ABC_ALLOC( char, nChunkSize + 100 );
+    char * pCur = pBuffer;
+    int * pLit, * pStop, i;
+    for ( i = 0; i < p->nClauses; i++ )
+    {
+        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
+        {
+            pCur = Cnf_DataWriteNum( pCur, fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
+            *pCur++ = ' ';
+            if ( pCur - pBuffer >= nChunkSize )
+            {
+                Cnf_DataWriteChunk( pFile, pFileGz, pBuffer, (int)(pCur - pBuffer) );
+                pCur = pBuffer;
+            }
+        }
+        *pCur++ = '0';
+        *pCur++ = '\n';
+        if ( pCur - pBuffer >= nChunkSize )
+        {
+            Cnf_DataWriteChunk( pFile, pFileGz, pBuffer, (int)(pCur - pBuffer) );
+            pCur = pBuffer;
+        }
+    }
+    if ( pCur > pBuffer )
+        Cnf_DataWriteChunk( pFile, pFileGz, pBuffer, (int)(pCur - pBuffer) );
+    ABC_FREE( pBuffer );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes CNF into a file.]
@@ -298,7 +362,7 @@ void Cnf_DataPrint( Cnf_Dat_t * p, int fReadable )
 void Cnf_DataWriteIntoFileGz( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists )
 {
     gzFile pFile;
-    int * pLit, * pStop, i, VarId;
+    int i, VarId;
     pFile = gzopen( pFileName, "wb" );
     if ( pFile == NULL )
     {
@@ -321,19 +385,14 @@ void Cnf_DataWriteIntoFileGz( Cnf_Dat_t * p, char * pFileName, int fReadable, Ve
             gzprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
         gzprintf( pFile, "0\n" );
     }
-    for ( i = 0; i < p->nClauses; i++ )
-    {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            gzprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        gzprintf( pFile, "0\n" );
-    }
+    Cnf_DataWriteClauses( p, NULL, pFile, fReadable );
     gzprintf( pFile, "\n" );
     gzclose( pFile );
 }
 void Cnf_DataWriteIntoFileInvGz( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vExists1, Vec_Int_t * vForAlls, Vec_Int_t * vExists2 )
 {
     gzFile pFile;
-    int * pLit, * pStop, i, VarId;
+    int i, VarId;
     pFile = gzopen( pFileName, "wb" );
     if ( pFile == NULL )
     {
@@ -363,12 +422,7 @@ void Cnf_DataWriteIntoFileInvGz( Cnf_Dat_t * p, char * pFileName, int fReadable,
             gzprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
         gzprintf( pFile, "0\n" );
     }
-    for ( i = 0; i < p->nClauses; i++ )
-    {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            gzprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        gzprintf( pFile, "0\n" );
-    }
+    Cnf_DataWriteClauses( p, NULL, pFile, fReadable );
     gzprintf( pFile, "\n" );
     gzclose( pFile );
 }
@@ -387,7 +441,7 @@ void Cnf_DataWriteIntoFileInvGz( Cnf_Dat_t * p, char * pFileName, int fReadable,
 void Cnf_DataWriteIntoFile( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists )
 {
     FILE * pFile;
-    int * pLit, * pStop, i, VarId;
+    int i, VarId;
     if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) ) 
     {
         Cnf_DataWriteIntoFileGz( p, pFileName, fReadable, vForAlls, vExists );
@@ -415,19 +469,14 @@ void Cnf_DataWriteIntoFile( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_
             fprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
         fprintf( pFile, "0\n" );
     }
-    for ( i = 0; i < p->nClauses; i++ )
-    {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            fprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        fprintf( pFile, "0\n" );
-    }
+    Cnf_DataWriteClauses( p, pFile, NULL, fReadable );
     fprintf( pFile, "\n" );
     fclose( pFile );
 }
 void Cnf_DataWriteIntoFileInv( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vExists1, Vec_Int_t * vForAlls, Vec_Int_t * vExists2 )
 {
     FILE * pFile;
-    int * pLit, * pStop, i, VarId;
+    int i, VarId;
     if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) ) 
     {
         Cnf_DataWriteIntoFileInvGz( p, pFileName, fReadable, vExists1, vForAlls, vExists2 );
@@ -462,12 +511,7 @@ void Cnf_DataWriteIntoFileInv( Cnf_Dat_t * p, char * pFileName, int fReadable, V
             fprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
         fprintf( pFile, "0\n" );
     }
-    for ( i = 0; i < p->nClauses; i++ )
-    {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            fprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        fprintf( pFile, "0\n" );
-    }
+    Cnf_DataWriteClauses( p, pFile, NULL, fReadable );
     fprintf( pFile, "\n" );
     fclose( pFile );
 }
@@ -834,6 +834,34 @@ void Glucose_ReadDimacs( char * pFileName, SimpSolver& s )
     ABC_FREE( pBuffer );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts writing the DRAT proof requested by the parameters.]
+
+  Description [Returns 0 if the proof file cannot be opened. Proofs are
+  written by the one-shot runs of &glucose2 and "dsat -F". The incremental
+  solver used by &cec (bmcg_sat_solver) does not write them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Glucose2_StartProof( SimpSolver& S, Glucose2_Pars * pPars )
+{
+    FILE * pFile;
+    if ( pPars->pProof == NULL )
+        return 1;
+    pFile = fopen( pPars->pProof, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open proof file \"%s\" for writing.\n", pPars->pProof );
+        return 0;
+    }
+    S.certifiedStart( pFile, pPars->fBinProof != 0 );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -853,10 +881,15 @@ void Glucose2_SolveCnf( char * pFileName, Glucose2_Pars * pPars )
     S.verbosity = pPars->verb;
     S.setConfBudget( pPars->nConfls > 0 ? (int64_t)pPars->nConfls : -1 );
 
+    if ( !Glucose2_StartProof( S, pPars ) )
+        return;
+
 //    gzFile in = gzopen(pFilename, "rb");
 //    parse_DIMACS(in, S);
 //    gzclose(in);
+    S.parsing = 1;
     Glucose_ReadDimacs( pFileName, S );
+    S.parsing = 0;
 
     if ( pPars->verb )
     {
@@ -891,7 +924,7 @@ void Glucose2_SolveCnf( char * pFileName, Glucose2_Pars * pPars )
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Glucose_SolverFromAig( Gia_Man_t * p, SimpSolver& s )
+Vec_Int_t * Glucose_SolverFromAig( Gia_Man_t * p, SimpSolver& s, char * pCnfFile )
 {
     abctime clk = Abc_Clock();
     vec<Lit> * lits = &s.user_lits;
@@ -903,6 +936,8 @@ Vec_Int_t * Glucose_SolverFromAig( Gia_Man_t * p, SimpSolver& s )
             lits->push( toLit(*pLit) ), s.addVar( *pLit >> 1 );
         s.addClause(*lits);
     }
+    if ( pCnfFile ) // the proof checker needs the same CNF
+        Cnf_DataWriteIntoFile( pCnf, pCnfFile, 0, NULL, NULL );
     Vec_Int_t * vCnfIds = Vec_IntAllocArrayCopy(pCnf->pVarNums, Gia_ManObjNum(p));
     printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
@@ -1513,8 +1548,11 @@ int Glucose2_SolveAig(Gia_Man_t * p, Glucose2_Pars * pPars)
     //S.verbosity = 2;
     S.setConfBudget( pPars->nConfls > 0 ? (int64_t)pPars->nConfls : -1 );
 
+    if ( !Glucose2_StartProof( S, pPars ) )
+        return 0;
+
     S.parsing = 1;
-    Vec_Int_t * vCnfIds = Glucose_SolverFromAig(p,S);
+    Vec_Int_t * vCnfIds = Glucose_SolverFromAig(p,S,pPars->pProof ? Extra_FileNameGenericAppend(pPars->pProof, ".cnf") : NULL);
     S.parsing = 0;
 
     if (pPars->verb)
@@ -48,6 +48,8 @@ struct Glucose2_Pars_ {
     int verb;    // verbosity
     int cust;    // customizable
     int nConfls; // conflict limit (0 = no limit)
+    char * pProof; // file name for the DRAT proof (NULL = no proof)
+    int fBinProof; // write the proof in binary DRAT format
 };
 
 static inline Glucose2_Pars Glucose_CreatePars(int p, int v, int c, int nConfls)
@@ -57,6 +59,8 @@ static inline Glucose2_Pars Glucose_CreatePars(int p, int v, int c, int nConfls)
     pars.verb    = v;
     pars.cust    = c;
     pars.nConfls = nConfls;
+    pars.pProof  = NULL;
+    pars.fBinProof = 1;
     return pars;
 }
 
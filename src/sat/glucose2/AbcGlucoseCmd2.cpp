@@ -81,10 +81,12 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
     int pre     = 1;
     int verb    = 0;
     int nConfls = 0;
+    int fBinProof = 1;
+    char * pProof = NULL;
 
     Glucose2_Pars pPars;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Cpvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CDbpvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -99,6 +101,18 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
                 if ( nConfls < 0 )
                     goto usage;
                 break;
+            case 'D':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-D\" should be followed by a file name.\n" );
+                    goto usage;
+                }
+                pProof = argv[globalUtilOptind];
+                globalUtilOptind++;
+                break;
+            case 'b':
+                fBinProof ^= 1;
+                break;
             case 'p':
                 pre ^= 1;
                 break;
@@ -113,6 +127,8 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     pPars = Glucose_CreatePars(pre,verb,0,nConfls);
+    pPars.pProof    = pProof;
+    pPars.fBinProof = fBinProof;
 
     if ( argc == globalUtilOptind + 1 )
     {
@@ -132,9 +148,12 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
     
 usage:
-    Abc_Print( -2, "usage: &glucose2 [-C num] [-pvh] <file.cnf>\n" );
+    Abc_Print( -2, "usage: &glucose2 [-C num] [-D file] [-bpvh] <file.cnf>\n" );
     Abc_Print( -2, "\t             run Glucose 3.0 by Gilles Audemard and Laurent Simon\n" );
     Abc_Print( -2, "\t-C num     : conflict limit [default = %d]\n",  nConfls );
+    Abc_Print( -2, "\t-D file    : write the DRAT proof of UNSAT into this file [default = none]\n");
+    Abc_Print( -2, "\t             (for an AIG, the CNF is written into a file with extension \".cnf\")\n");
+    Abc_Print( -2, "\t-b         : toggle binary or text DRAT proof format [default = %s]\n", fBinProof ? "binary" : "text");
     Abc_Print( -2, "\t-p         : enable preprocessing [default = %d]\n",pre);
     Abc_Print( -2, "\t-v         : verbosity [default = %d]\n",verb);
     Abc_Print( -2, "\t-h         : print the command usage\n");
@@ -35,6 +35,16 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "sat/glucose2/CGlucose.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 using namespace Gluco2;
@@ -123,6 +133,11 @@ Solver::Solver() :
   , garbage_frac     (opt_garbage_frac)
   , certifiedOutput  (NULL)
   , certifiedUNSAT   (opt_certified_) 
+  , certifiedBinary  (false)
+  , certifiedBuf     (NULL)
+  , certifiedSize    (0)
+  , certifiedCap     (0)
+  , certifiedWriter  (NULL)
     // Statistics: (formerly in 'SolverStats')
     //
   ,  nbRemovedClauses(0),nbReducedClauses(0), nbDL2(0),nbBin(0),nbUn(0) , nbReduceDB(0)
@@ -168,9 +183,9 @@ Solver::Solver() :
 
   if(certifiedUNSAT) {
     if(!strcmp(opt_certified_file_,"NULL")) {
-      certifiedOutput =  fopen("/dev/stdout", "wb");
+      certifiedStart( fopen("/dev/stdout", "wb"), false );
     } else {
-      certifiedOutput =  fopen(opt_certified_file_, "wb");           
+      certifiedStart( fopen(opt_certified_file_, "wb"), false );
     }
     //    fprintf(certifiedOutput,"o proof DRUP\n");
   }
@@ -193,6 +208,148 @@ Solver::Solver() :
 
 Solver::~Solver()
 {
+  if (certifiedOutput)
+    certifiedStop(false);
+}
+
+
+/****************************************************************
+ Proof output: the solver fills one buffer while a background
+ thread writes the other one to the file
+****************************************************************/
+
+struct Gluco2_ProofWriter_t
+{
+  FILE *          pFile;
+  char *          pJob;      // buffer being written (NULL if idle)
+  int             nJob;
+  char *          pSpare;    // written buffer ready for reuse
+  int             nSpareCap;
+  int             fStop;
+#ifdef ABC_USE_PTHREADS
+  pthread_t       Thread;
+  pthread_mutex_t Mutex;
+  pthread_cond_t  Cond;
+#endif
+};
+
+#ifdef ABC_USE_PTHREADS
+static void * Gluco2_ProofWriterThread( void * pArg )
+{
+  Gluco2_ProofWriter_t * p = (Gluco2_ProofWriter_t *)pArg;
+  pthread_mutex_lock( &p->Mutex );
+  while ( 1 )
+  {
+    while ( p->pJob == NULL && !p->fStop )
+      pthread_cond_wait( &p->Cond, &p->Mutex );
+    if ( p->pJob == NULL )
+      break;
+    char * pBuf = p->pJob; int nBuf = p->nJob;
+    pthread_mutex_unlock( &p->Mutex );
+    fwrite( pBuf, 1, nBuf, p->pFile );
+    pthread_mutex_lock( &p->Mutex );
+    p->pJob = NULL;
+    pthread_cond_broadcast( &p->Cond );
+  }
+  pthread_mutex_unlock( &p->Mutex );
+  return NULL;
+}
+#endif
+
+void Solver::certifiedStart(FILE* pFile, bool fBinary)
+{
+  assert( certifiedOutput == NULL );
+  certifiedOutput = pFile;
+  certifiedUNSAT  = true;
+  certifiedBinary = fBinary;
+  certifiedSize   = 0;
+  certifiedCap    = 2 * (1 << 20);
+  certifiedBuf    = (char *)malloc( certifiedCap );
+  certifiedWriter = NULL;
+#ifdef ABC_USE_PTHREADS
+  Gluco2_ProofWriter_t * p = (Gluco2_ProofWriter_t *)calloc( 1, sizeof(Gluco2_ProofWriter_t) );
+  p->pFile = pFile;
+  pthread_mutex_init( &p->Mutex, NULL );
+  pthread_cond_init( &p->Cond, NULL );
+  if ( pthread_create( &p->Thread, NULL, Gluco2_ProofWriterThread, (void *)p ) == 0 )
+    certifiedWriter = p;
+  else
+  {
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    free( p );
+  }
+#endif
+}
+
+void Solver::certifiedFlush(int nExtra)
+{
+  Gluco2_ProofWriter_t * p = (Gluco2_ProofWriter_t *)certifiedWriter;
+  if ( certifiedSize > 0 && p == NULL )
+  {
+    fwrite( certifiedBuf, 1, certifiedSize, certifiedOutput );
+    certifiedSize = 0;
+  }
+#ifdef ABC_USE_PTHREADS
+  else if ( certifiedSize > 0 )
+  {
+    // wait until the previous buffer is written, then swap
+    pthread_mutex_lock( &p->Mutex );
+    while ( p->pJob )
+      pthread_cond_wait( &p->Cond, &p->Mutex );
+    char * pTemp = p->pSpare; int nTempCap = p->nSpareCap;
+    p->pJob      = certifiedBuf;
+    p->nJob      = certifiedSize;
+    p->pSpare    = certifiedBuf;
+    p->nSpareCap = certifiedCap;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    certifiedCap  = pTemp ? nTempCap : 2 * (1 << 20);
+    certifiedBuf  = pTemp ? pTemp : (char *)malloc( certifiedCap );
+    certifiedSize = 0;
+  }
+#endif
+  if ( certifiedCap < certifiedSize + nExtra )
+  {
+    certifiedCap = certifiedSize + nExtra;
+    certifiedBuf = (char *)realloc( certifiedBuf, certifiedCap );
+  }
+}
+
+void Solver::certifiedStop(bool fUnsat)
+{
+  if ( certifiedOutput == NULL )
+    return;
+  if ( fUnsat )
+  {
+    vec<Lit> empty;
+    certifiedClause( empty, false );
+  }
+  certifiedFlush( 0 );
+#ifdef ABC_USE_PTHREADS
+  Gluco2_ProofWriter_t * p = (Gluco2_ProofWriter_t *)certifiedWriter;
+  if ( p )
+  {
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    pthread_join( p->Thread, NULL );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    if ( p->pSpare != certifiedBuf )
+      free( p->pSpare );
+    free( p );
+    certifiedWriter = NULL;
+  }
+#endif
+  free( certifiedBuf );
+  certifiedBuf    = NULL;
+  certifiedSize   = certifiedCap = 0;
+  if ( certifiedOutput != stdout )
+    fclose( certifiedOutput );
+  certifiedOutput = NULL;
+  certifiedUNSAT  = false;
 }
 
 
@@ -305,14 +462,8 @@ bool Solver::addClause_(vec<Lit>& ps)
     }
     
     if (flag && (certifiedUNSAT)) {
-      for (i = j = 0, p = lit_Undef; i < ps.size(); i++)
-        fprintf(certifiedOutput, "%i ", (var(ps[i]) + 1) * (-2 * sign(ps[i]) + 1));
-      fprintf(certifiedOutput, "0\n");
-
-      fprintf(certifiedOutput, "d ");
-      for (i = j = 0, p = lit_Undef; i < oc.size(); i++)
-        fprintf(certifiedOutput, "%i ", (var(oc[i]) + 1) * (-2 * sign(oc[i]) + 1));
-      fprintf(certifiedOutput, "0\n");
+      certifiedClause(ps, false);
+      certifiedClause(oc, true);
     }
 
     if (ps.size() == 0)
@@ -378,12 +529,8 @@ void Solver::removeClause(CRef cr) {
 
   Clause& c = ca[cr];
 
-  if (certifiedUNSAT) {
-    fprintf(certifiedOutput, "d ");
-    for (int i = 0; i < c.size(); i++)
-      fprintf(certifiedOutput, "%i ", (var(c[i]) + 1) * (-2 * sign(c[i]) + 1));
-    fprintf(certifiedOutput, "0\n");
-  }
+  if (certifiedUNSAT)
+    certifiedClause(c, true);
 
   detachClause(cr);
   // Don't leave pointers to free'd memory!
@@ -1249,12 +1396,8 @@ lbool Solver::search(int nof_conflicts)
             lbdQueue.push(nblevels);
             sumLBD += nblevels;
             cancelUntil(backtrack_level);
-            if (certifiedUNSAT) {
-              for (int i = 0; i < learnt_clause.size(); i++)
-                fprintf(certifiedOutput, "%i " , (var(learnt_clause[i]) + 1) *
-                            (-2 * sign(learnt_clause[i]) + 1) );
-              fprintf(certifiedOutput, "0\n");
-            }
+            if (certifiedUNSAT)
+              certifiedClause(learnt_clause, false);
 
             if (learnt_clause.size() == 1){
               uncheckedEnqueue(learnt_clause[0]);nbUn++;
@@ -1403,6 +1546,8 @@ lbool Solver::solve_()
     conflict.shrink_(conflict.size());
     if (!ok){
       travId_prev = travId;
+      if (certifiedUNSAT)
+        certifiedStop(true);
       return l_False;
     }
     double curTime = cpuTime();
@@ -1443,11 +1588,8 @@ printf("c ==================================[ Search Statistics (every %6d confl
       printf("c =========================================================================================================\n");
 
 
-    if (certifiedUNSAT){ // Want certified output
-      if (status == l_False)
-        fprintf(certifiedOutput, "0\n");
-      fclose(certifiedOutput);
-    }
+    if (certifiedUNSAT) // Want certified output
+      certifiedStop(status == l_False);
 
 
     if (status == l_True){
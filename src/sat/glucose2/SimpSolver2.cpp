@@ -150,11 +150,8 @@ bool SimpSolver::addClause_(vec<Lit>& ps)
     if (!Solver::addClause_(ps))
         return false;
 
-    if(!parsing && certifiedUNSAT) {
-      for (int i = 0; i < ps.size(); i++)
-        fprintf(certifiedOutput, "%i " , (var(ps[i]) + 1) * (-2 * sign(ps[i]) + 1) );
-      fprintf(certifiedOutput, "0\n");
-    }
+    if(!parsing && certifiedUNSAT)
+      certifiedClause(ps, false);
 
     if (use_simplification && clauses.size() == nclauses + 1){
         CRef          cr = clauses.last();
@@ -206,22 +203,15 @@ bool SimpSolver::strengthenClause(CRef cr, Lit l)
     // if (!find(subsumption_queue, &c))
     subsumption_queue.insert(cr);
 
-    if (certifiedUNSAT) {
-      for (int i = 0; i < c.size(); i++)
-        if (c[i] != l) fprintf(certifiedOutput, "%i " , (var(c[i]) + 1) * (-2 * sign(c[i]) + 1) );
-      fprintf(certifiedOutput, "0\n");
-    }
+    if (certifiedUNSAT)
+      certifiedClause(c, false, l);
 
     if (c.size() == 2){
         removeClause(cr);
         c.strengthen(l);
     }else{
-        if (certifiedUNSAT) {
-          fprintf(certifiedOutput, "d ");
-          for (int i = 0; i < c.size(); i++)
-            fprintf(certifiedOutput, "%i " , (var(c[i]) + 1) * (-2 * sign(c[i]) + 1) );
-          fprintf(certifiedOutput, "0\n");
-        }
+        if (certifiedUNSAT)
+          certifiedClause(c, true);
 
         detachClause(cr, true);
         c.strengthen(l);
@@ -193,6 +193,17 @@ public:
     // Certified UNSAT ( Thanks to Marijn Heule)
     FILE*               certifiedOutput;
     bool                certifiedUNSAT;
+    bool                certifiedBinary;    // write binary DRAT instead of text DRUP
+    char*               certifiedBuf;       // proof bytes not yet handed to the writer
+    int                 certifiedSize;
+    int                 certifiedCap;
+    void*               certifiedWriter;    // background writer thread (NULL = write synchronously)
+
+    void     certifiedStart   (FILE* pFile, bool fBinary);  // Start writing the proof into an open file.
+    void     certifiedStop    (bool fUnsat);                // Flush the proof, add the empty clause if UNSAT, close the file.
+    void     certifiedFlush   (int nExtra);                 // Hand the buffer to the writer and make room for 'nExtra' bytes.
+    template<class V>
+    void     certifiedClause  (const V& c, bool fDelete, Lit skip = lit_Undef); // Add or delete a lemma (without 'skip').
 
     
     // Statistics: (read-only member variable)
@@ -529,6 +540,35 @@ inline void Solver::checkGarbage(double gf){
 
 // NOTE: enqueue does not set the ok flag! (only public methods do)
 inline bool     Solver::enqueue         (Lit p, CRef from)      { return value(p) != l_Undef ? value(p) != l_False : (uncheckedEnqueue(p, from), true); }
+template<class V>
+inline void Solver::certifiedClause(const V& c, bool fDelete, Lit skip)
+{
+    if (certifiedSize + 12 * c.size() + 16 > certifiedCap)
+        certifiedFlush(12 * c.size() + 16);
+    char * pBuf = certifiedBuf + certifiedSize;
+    if (certifiedBinary){
+        // binary DRAT: 'a'/'d', then literals 2*(var+1)+sign in 7-bit varint encoding, then 0
+        *pBuf++ = fDelete ? 'd' : 'a';
+        for (int i = 0; i < c.size(); i++){
+            if (c[i] == skip) continue;
+            unsigned u = (unsigned)toInt(c[i]) + 2;
+            for ( ; u > 127; u >>= 7)
+                *pBuf++ = (char)(128 | (u & 127));
+            *pBuf++ = (char)u;
+        }
+        *pBuf++ = 0;
+    }else{
+        if (fDelete) { *pBuf++ = 'd'; *pBuf++ = ' '; }
+        for (int i = 0; i < c.size(); i++)
+            if (c[i] != skip)
+                pBuf += sprintf(pBuf, "%s%d ", sign(c[i]) ? "-" : "", var(c[i]) + 1);
+        *pBuf++ = '0'; *pBuf++ = '\n';
+    }
+    certifiedSize = (int)(pBuf - certifiedBuf);
+    if (certifiedSize >= (1 << 20))
+        certifiedFlush(0);
+}
+
 inline bool     Solver::addClause       (const vec<Lit>& ps)    { ps.copyTo(add_tmp); return addClause_(add_tmp); }
 inline bool     Solver::addEmptyClause  ()                      { add_tmp.clear(); return addClause_(add_tmp); }
 inline bool     Solver::addClause       (Lit p)                 { add_tmp.clear(); add_tmp.push(p); return addClause_(add_tmp); }
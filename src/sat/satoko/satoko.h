@@ -110,6 +110,9 @@ extern void satoko_unmark_cone(satoko_t *, int *, int);
 extern void satoko_rollback(satoko_t *);
 extern void satoko_bookmark(satoko_t *);
 extern void satoko_unbookmark(satoko_t *);
+/* Returns an independent copy of the solver taken at decision level zero,
+ * used to solve related queries (e.g. different cubes) from a common state. */
+extern satoko_t *satoko_fork(satoko_t *);
 /* If problem is unsatisfiable under assumptions, this function is used to
  * obtain the final conflict clause expressed in the assumptions.
  *  - It receives as inputs the solver and a pointer to an array where clause
@@ -139,6 +142,7 @@ extern int satoko_conflictnum(satoko_t *);
 extern void satoko_set_stop(satoko_t *, int *);
 extern void satoko_set_stop_func(satoko_t *s, int (*fnct)(int));
 extern void satoko_set_runid(satoko_t *, int);
+extern void satoko_set_share(satoko_t *, void *, void (*)(void *, int, int *, int, int), int * (*)(void *, int, int *));
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
 extern char satoko_var_polarity(satoko_t *, unsigned);
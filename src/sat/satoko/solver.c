@@ -356,6 +356,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
         clause_watch(s, cref);
     }
     solver_enqueue(s, vec_uint_at(s->temp_lits, 0), cref);
+    if (s->pFuncExport)
+        s->pFuncExport(s->pShare, s->RunId, (int *)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
     var_act_decay(s);
     clause_act_decay(s);
 }
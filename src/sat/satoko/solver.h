@@ -106,6 +106,11 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Callbacks to share learnt clauses with other solvers */
+    void   *pShare;
+    void  (*pFuncExport)(void *, int, int *, int, int);
+    int * (*pFuncImport)(void *, int, int *);
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -311,6 +311,17 @@ void satoko_assump_pop(solver_t *s)
     solver_cancel_until(s, vec_uint_size(s->assumptions));
 }
 
+/* Adds the clauses learnt by other solvers (returns 0 if the problem became UNSAT) */
+static int solver_import(solver_t *s)
+{
+    int *lits, size;
+    assert(solver_dlevel(s) == 0);
+    while ((lits = s->pFuncImport(s->pShare, s->RunId, &size)))
+        if (satoko_add_clause(s, lits, size) != SATOKO_OK)
+            return 0;
+    return 1;
+}
+
 int satoko_solve(solver_t *s)
 {
     int status = SATOKO_UNDEC;
@@ -324,6 +335,10 @@ int satoko_solve(solver_t *s)
         return SATOKO_UNDEC;
     }
 
+    if (s->pFuncImport && solver_dlevel(s) == 0 && !solver_import(s)) {
+        vec_uint_clear(s->final_conflict);
+        return SATOKO_UNSAT;
+    }
     if (!s->opts.no_simplify)
         if (satoko_simplify(s) != SATOKO_OK)
             return SATOKO_UNDEC;
@@ -336,6 +351,10 @@ int satoko_solve(solver_t *s)
             break;
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
+        if (status == SATOKO_UNDEC && s->pFuncImport && solver_dlevel(s) == 0 && !solver_import(s)) {
+            vec_uint_clear(s->final_conflict);
+            status = SATOKO_UNSAT;
+        }
     }
     if (s->opts.verbose)
         print_stats(s);
@@ -559,6 +578,95 @@ void satoko_rollback(satoko_t *s)
     // s->book_qhead = 0;
 }
 
+/* Copies one watch list vector, keeping the clause references valid in the
+ * copied clause database. */
+static void solver_watches_copy(vec_wl_t *dest, vec_wl_t *src)
+{
+    unsigned i;
+    while (dest->size < src->size)
+        vec_wl_push(dest);
+    for (i = 0; i < src->size; i++) {
+        struct watch_list *wl_src = src->watch_lists + i;
+        struct watch_list *wl_dest = dest->watch_lists + i;
+        if (wl_src->cap == 0)
+            continue;
+        wl_dest->watchers = satoko_alloc(struct watcher, wl_src->cap);
+        memcpy(wl_dest->watchers, wl_src->watchers, sizeof(struct watcher) * wl_src->size);
+        wl_dest->cap = wl_src->cap;
+        wl_dest->size = wl_src->size;
+        wl_dest->n_bin = wl_src->n_bin;
+    }
+}
+
+/* Creates an independent child of the solver at decision level zero. The
+ * child starts with the same clause database (original and learnt clauses),
+ * watches, variable activities, saved phases and top-level trail, so it can
+ * be given its own clauses and assumptions without re-adding the shared CNF.
+ * Children do not share memory with the parent and can be solved in
+ * separate threads. Callbacks for clause sharing are not inherited. */
+satoko_t *satoko_fork(satoko_t *s)
+{
+    solver_t *p;
+    if (solver_dlevel(s) > 0)
+        solver_cancel_until(s, 0);
+    p = satoko_create();
+    p->opts = s->opts;
+    p->status = s->status;
+    /* Clauses Database */
+    cdb_grow(p->all_clauses, cdb_size(s->all_clauses));
+    memcpy(p->all_clauses->data, s->all_clauses->data, sizeof(unsigned) * cdb_size(s->all_clauses));
+    p->all_clauses->size = s->all_clauses->size;
+    p->all_clauses->wasted = s->all_clauses->wasted;
+    vec_uint_duplicate(p->originals, s->originals);
+    vec_uint_duplicate(p->learnts, s->learnts);
+    solver_watches_copy(p->watches, s->watches);
+    /* Activity heuristic */
+    p->var_act_inc = s->var_act_inc;
+    p->clause_act_inc = s->clause_act_inc;
+    /* Variable Information */
+    vec_sdbl_duplicate(p->activity, s->activity);
+    vec_int_duplicate(p->var_order->indices, s->var_order->indices);
+    vec_uint_duplicate(p->var_order->data, s->var_order->data);
+    vec_uint_duplicate(p->levels, s->levels);
+    vec_uint_duplicate(p->reasons, s->reasons);
+    vec_char_duplicate(p->assigns, s->assigns);
+    vec_char_duplicate(p->polarity, s->polarity);
+    /* Assignments */
+    vec_uint_duplicate(p->trail, s->trail);
+    p->i_qhead = s->i_qhead;
+    p->n_assigns_simplify = s->n_assigns_simplify;
+    p->n_props_simplify = s->n_props_simplify;
+    /* Temporary data */
+    b_queue_free(p->bq_trail);
+    b_queue_free(p->bq_lbd);
+    p->bq_trail = b_queue_alloc(p->opts.sz_trail_bqueue);
+    p->bq_lbd = b_queue_alloc(p->opts.sz_lbd_bqueue);
+    p->RC1 = s->RC1;
+    p->RC2 = s->RC2;
+    p->n_confl_bfr_reduce = s->n_confl_bfr_reduce;
+    p->sum_lbd = s->sum_lbd;
+    vec_char_duplicate(p->seen, s->seen);
+    vec_uint_duplicate(p->stamps, s->stamps);
+    p->cur_stamp = s->cur_stamp;
+    if (s->marks) {
+        p->marks = vec_char_alloc(0);
+        vec_char_duplicate(p->marks, s->marks);
+    }
+    /* Bookmark */
+    p->book_cl_orig = s->book_cl_orig;
+    p->book_cl_lrnt = s->book_cl_lrnt;
+    p->book_cdb = s->book_cdb;
+    p->book_vars = s->book_vars;
+    p->book_trail = s->book_trail;
+    /* Callbacks to stop the solver */
+    p->nRuntimeLimit = s->nRuntimeLimit;
+    p->pstop = s->pstop;
+    p->RunId = s->RunId;
+    p->pFuncStop = s->pFuncStop;
+    p->stats = s->stats;
+    return p;
+}
+
 void satoko_mark_cone(satoko_t *s, int * pvars, int n_vars)
 {
     int i;
@@ -657,6 +765,13 @@ void satoko_set_runid(satoko_t *s, int id)
     s->RunId = id;
 }
 
+void satoko_set_share(satoko_t *s, void * pShare, void (*pExport)(void *, int, int *, int, int), int * (*pImport)(void *, int, int *))
+{
+    s->pShare = pShare;
+    s->pFuncExport = pExport;
+    s->pFuncImport = pImport;
+}
+
 int satoko_read_cex_varvalue(satoko_t *s, int ivar)
 {
     return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;